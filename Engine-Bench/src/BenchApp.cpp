@@ -0,0 +1,36 @@
+#include <Engine.h>
+#include <Engine/Core/EntryPoint.h>
+
+#include "BenchLayer.h"
+
+class BenchApp : public Engine::Application
+{
+public:
+	BenchApp(const Engine::ApplicationSpecification& specification)
+		: Engine::Application(specification)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		PushLayer(new BenchLayer());
+	}
+
+	~BenchApp()
+	{
+		ENGINE_PROFILE_FUNCTION();
+	}
+};
+
+Engine::Application* Engine::CreateApplication(Engine::ApplicationCommandLineArgs args)
+{
+	ApplicationSpecification spec;
+	spec.Name = "Engine-Bench";
+#if ENGINE_DIST
+	spec.WorkingDirectory = "";
+#else
+	spec.WorkingDirectory = "../Engine-Editor";
+#endif
+	spec.CommandLineArgs = args;
+	spec.Headless = true;
+
+	return new BenchApp(spec);
+}
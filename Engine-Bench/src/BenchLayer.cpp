@@ -0,0 +1,95 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+
+void BenchLayer::OnAttach()
+{
+	if (!ParseCommandLineArgs())
+	{
+		ENGINE_CORE_ERROR("Usage: Engine-Bench [--count <elements>] [--only <bench name>]");
+		Engine::Application::Get().Close();
+		return;
+	}
+
+	ENGINE_CORE_INFO("Engine bench: {} elements, {} workers", m_Count, Engine::JobSystem::GetWorkerCount());
+
+	struct Bench
+	{
+		const char* Name;
+		void (BenchLayer::*Function)();
+		bool NeedsProject = false;
+	};
+
+	const Bench benches[] =
+	{
+		{ "jobs", &BenchLayer::BenchJobSystem },
+		{ "names", &BenchLayer::BenchNameIndex },
+		{ "flathashmap", &BenchLayer::BenchFlatHashMap },
+		{ "spatial", &BenchLayer::BenchSpatialIndex },
+		{ "transform", &BenchLayer::BenchTransformCache },
+		{ "uuid", &BenchLayer::BenchUUID },
+		{ "transparent", &BenchLayer::BenchTransparentSort },
+		{ "prefab", &BenchLayer::BenchPrefabPool, true },
+		{ "destroy", &BenchLayer::BenchDestroyEntities },
+		{ "groups", &BenchLayer::BenchGroupIteration },
+		{ "scenes", &BenchLayer::BenchSceneCatalog, true }
+	};
+
+	// Loaded once up front, the script engine can't be started twice
+	bool needsProject = false;
+	for (const Bench& bench : benches)
+		needsProject |= bench.NeedsProject && (m_Only.empty() || m_Only == bench.Name);
+
+	if (needsProject && !LoadProject())
+	{
+		ENGINE_CORE_ERROR("Engine bench: couldn't load the generated project");
+		Engine::Application::Get().Close();
+		return;
+	}
+
+	for (const Bench& bench : benches)
+	{
+		if (!m_Only.empty() && m_Only != bench.Name)
+			continue;
+
+		(this->*bench.Function)();
+	}
+
+	if (m_FailedCount == 0)
+		ENGINE_CORE_INFO("Engine bench: all {} checks passed", m_CheckCount);
+	else
+		ENGINE_CORE_ERROR("Engine bench: {} of {} checks failed", m_FailedCount, m_CheckCount);
+
+	Engine::Application::Get().Close();
+}
+
+bool BenchLayer::ParseCommandLineArgs()
+{
+	const auto& args = Engine::Application::Get().GetSpecification().CommandLineArgs;
+	for (int i = 1; i < args.Count; ++i)
+	{
+		std::string arg = args[i];
+		if (i + 1 >= args.Count)
+			return false;
+
+		if (arg == "--count")
+			m_Count = (uint32_t)std::stoul(args[++i]);
+		else if (arg == "--only")
+			m_Only = args[++i];
+		else
+			return false;
+	}
+
+	return m_Count > 0;
+}
+
+bool BenchLayer::Check(bool condition, const char* description)
+{
+	m_CheckCount++;
+	if (!condition)
+	{
+		m_FailedCount++;
+		ENGINE_CORE_ERROR("  FAILED: {}", description);
+	}
+
+	return condition;
+}
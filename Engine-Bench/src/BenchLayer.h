@@ -0,0 +1,49 @@
+#pragma once
+#include <Engine.h>
+
+// Checks and times engine subsystems. Each bench first checks its results against a plain reference
+// (std containers, brute force or a single thread), then reports timings for both.
+// Logs a summary with the number of failed checks and closes when done.
+//
+// Usage: Engine-Bench [--count <elements>] [--only <bench name>]
+class BenchLayer : public Engine::Layer
+{
+public:
+	BenchLayer()
+		: Engine::Layer("BenchLayer") {}
+	virtual ~BenchLayer() = default;
+
+	void OnAttach() override;
+
+private:
+	bool ParseCommandLineArgs();
+	// Generates a project with the assets the scene benches use, packs and loads it
+	bool LoadProject();
+
+	// Each defined in Benches/
+	void BenchJobSystem();
+	void BenchNameIndex();
+	void BenchFlatHashMap();
+	void BenchSpatialIndex();
+	void BenchTransformCache();
+	void BenchUUID();
+	void BenchTransparentSort();
+	void BenchPrefabPool();
+	void BenchDestroyEntities();
+	void BenchGroupIteration();
+	void BenchSceneCatalog();
+
+	// Logs and counts a failed check, returns condition
+	bool Check(bool condition, const char* description);
+
+private:
+	uint32_t m_Count = 100000;
+	std::string m_Only;
+
+	Engine::AssetHandle m_PrefabHandle = Engine::AssetHandle::INVALID();
+	std::map<Engine::AssetHandle, std::string> m_SceneNames;
+	uint32_t m_SceneEntityCount = 0;
+
+	uint32_t m_CheckCount = 0;
+	uint32_t m_FailedCount = 0;
+};
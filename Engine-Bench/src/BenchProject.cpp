@@ -0,0 +1,80 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+
+#include <Engine/Asset/AssetPakSerializer.h>
+#include <Engine/Scene/Prefab.h>
+
+bool BenchLayer::LoadProject()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	std::filesystem::path projectDirectory = std::filesystem::temp_directory_path() / "Engine-Bench";
+	std::filesystem::path projectPath = projectDirectory / "Engine-Bench.gameproj";
+	std::filesystem::remove_all(projectDirectory);
+	std::filesystem::create_directories(projectDirectory / "Assets");
+
+	// The runtime asset manager reads everything from the pak, so it's written before the project is loaded.
+	// There are no game scripts, the core assembly stands in for the script module.
+	Engine::Ref<Engine::Project> project = Engine::Project::New();
+	auto& config = project->GetConfig();
+	config.Name = "Engine-Bench";
+	config.AssetDirectory = "Assets";
+	config.AssetRegistryPath = "AssetRegistry.yaml";
+	config.AssetPakPath = "AssetPak.gpk";
+	config.ScriptModulePath = std::filesystem::absolute("Resources/Scripts/Binaries/Engine-ScriptCore.dll");
+	Engine::Project::SaveAs(projectPath);
+
+	Engine::AssetRegistry registry;
+	Engine::AssetMap assets;
+	auto addAsset = [&](const Engine::Ref<Engine::Asset>& asset, const std::filesystem::path& path)
+	{
+		asset->Handle = Engine::AssetHandle();
+
+		Engine::AssetMetadata metadata;
+		metadata.Type = asset->GetAssetType();
+		metadata.Path = path;
+		metadata.Compress = false;
+		registry[asset->Handle] = metadata;
+		assets[asset->Handle] = asset;
+		return asset->Handle;
+	};
+
+	// A bullet: a dynamic body with a sprite and a trail under it
+	Engine::Ref<Engine::Scene> prefabSource = Engine::CreateRef<Engine::Scene>("Prefab Source");
+	Engine::Entity bullet = prefabSource->CreateEntity("Bullet");
+	bullet.AddComponent<Engine::Rigidbody2DComponent>().Type = Engine::Rigidbody2DComponent::BodyType::Dynamic;
+	bullet.AddComponent<Engine::CircleCollider2DComponent>();
+
+	Engine::Entity sprite = prefabSource->CreateEntity("Sprite");
+	sprite.AddComponent<Engine::SpriteRendererComponent>();
+	bullet.AddChild(sprite);
+
+	Engine::Entity trail = prefabSource->CreateEntity("Trail");
+	trail.AddComponent<Engine::CircleRendererComponent>();
+	bullet.AddChild(trail);
+
+	m_PrefabHandle = addAsset(Engine::CreateRef<Engine::Prefab>(bullet), "Prefabs/Bullet.prefab");
+
+	// Levels of sprites, every tenth with a child
+	const uint32_t sceneCount = 50;
+	m_SceneEntityCount = std::max(m_Count / 500, 1u);
+	for (uint32_t i = 0; i < sceneCount; ++i)
+	{
+		std::string name = "Level " + std::to_string(i);
+		Engine::Ref<Engine::Scene> scene = Engine::CreateRef<Engine::Scene>(name);
+		for (uint32_t j = 0; j < m_SceneEntityCount; ++j)
+		{
+			Engine::Entity entity = scene->CreateEntity("Sprite");
+			entity.GetComponent<Engine::TransformComponent>().Position = { (float)j, (float)i, 0.0f };
+			entity.AddComponent<Engine::SpriteRendererComponent>();
+			if (j % 10 == 9)
+				entity.AddChild(scene->CreateEntity("Child"));
+		}
+
+		m_SceneNames[addAsset(scene, "Scenes/" + name + ".scene")] = name;
+	}
+
+	Engine::AssetPakSerializer().Serialize(registry, assets);
+
+	return Engine::Project::Load(projectPath) != nullptr;
+}
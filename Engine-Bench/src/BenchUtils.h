@@ -0,0 +1,25 @@
+#pragma once
+#include <Engine.h>
+#include <Engine/Core/Timer.h>
+
+namespace Utils
+{
+	template<typename Fn>
+	inline float Measure(Fn&& function)
+	{
+		Engine::Timer timer;
+		function();
+		return timer.ElapsedMillis();
+	}
+
+	inline void LogTiming(const char* name, float milliseconds, uint32_t count)
+	{
+		ENGINE_CORE_INFO("  {:<32} {:>10.3f} ms {:>10.2f} ns/op", name, milliseconds, count > 0 ? milliseconds * 1000000.0f / count : 0.0f);
+	}
+
+	inline std::vector<entt::entity> Sorted(std::vector<entt::entity> entities)
+	{
+		std::sort(entities.begin(), entities.end());
+		return entities;
+	}
+}
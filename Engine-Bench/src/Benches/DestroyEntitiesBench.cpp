@@ -0,0 +1,129 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+void BenchLayer::BenchDestroyEntities()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	// Groups of a root with nine children
+	const uint32_t childCount = 9;
+	uint32_t groupCount = std::max(m_Count / (childCount + 1), 1u);
+	uint32_t entityTotal = groupCount * (childCount + 1);
+	ENGINE_CORE_INFO("Scene::DestroyEntities against DestroyEntity per entity, {} groups of {}", groupCount, childCount + 1);
+
+	struct Level
+	{
+		Engine::Ref<Engine::Scene> Scene;
+		std::vector<Engine::Entity> Roots;
+		std::vector<Engine::Entity> Children;
+	};
+
+	auto buildLevel = [&]()
+	{
+		Level level;
+		level.Scene = Engine::CreateRef<Engine::Scene>("Destroy Bench");
+		level.Roots.reserve(groupCount);
+		level.Children.reserve((size_t)groupCount * childCount);
+		for (uint32_t group = 0; group < groupCount; ++group)
+		{
+			Engine::Entity root = level.Scene->CreateEntity("Group");
+			level.Roots.push_back(root);
+			for (uint32_t child = 0; child < childCount; ++child)
+			{
+				Engine::Entity entity = level.Scene->CreateEntity("Member");
+				root.AddChild(entity);
+				level.Children.push_back(entity);
+			}
+		}
+		return level;
+	};
+
+	auto entityCount = [](Level& target) { return (uint32_t)target.Scene->GetAllEntitiesWith<Engine::IDComponent>().size(); };
+
+	// Level unload: every root, their subtrees go with them
+	Level level = buildLevel();
+	Check(entityCount(level) == entityTotal, "levels are built");
+	float unloadTime = Utils::Measure([&]() { level.Scene->DestroyEntities(level.Roots); });
+	Check(entityCount(level) == 0 && level.Scene->FindEntitiesByName("Member").empty(), "unloading the roots destroys every entity");
+
+	level = buildLevel();
+	float unloadSingleTime = Utils::Measure([&]()
+	{
+		for (Engine::Entity root : level.Roots)
+			level.Scene->DestroyEntity(root);
+	});
+	Check(entityCount(level) == 0, "destroying the roots one at a time destroys every entity");
+
+	// Mass despawn: every other group, and every third child of the groups that stay. Those are unlinked from their parent.
+	auto selectDespawns = [&](Level& target)
+	{
+		std::vector<Engine::Entity> despawned;
+		for (uint32_t group = 0; group < groupCount; ++group)
+		{
+			if (group % 2 == 0)
+			{
+				despawned.push_back(target.Roots[group]);
+				continue;
+			}
+
+			for (uint32_t child = 0; child < childCount; child += 3)
+				despawned.push_back(target.Children[(size_t)group * childCount + child]);
+		}
+		return despawned;
+	};
+
+	const uint32_t removedChildren = (childCount + 2) / 3;
+	const uint32_t keptGroups = groupCount / 2;
+	const uint32_t expectedCount = keptGroups * (childCount + 1 - removedChildren);
+
+	auto checkDespawned = [&](Level& target, const std::vector<Engine::UUID>& despawnedIDs, const char* description)
+	{
+		bool valid = entityCount(target) == expectedCount;
+		for (Engine::UUID entityID : despawnedIDs)
+			valid = valid && !target.Scene->DoesEntityExist(entityID);
+
+		// Surviving groups keep a consistent sibling list
+		for (uint32_t group = 1; group < groupCount && valid; group += 2)
+		{
+			Engine::Entity root = target.Roots[group];
+			valid = root.GetComponent<Engine::RelationshipComponent>().ChildrenCount == childCount - removedChildren
+				&& root.Children().size() == childCount - removedChildren;
+		}
+		Check(valid, description);
+	};
+
+	level = buildLevel();
+	std::vector<Engine::Entity> despawned = selectDespawns(level);
+	std::vector<Engine::UUID> despawnedIDs;
+	despawnedIDs.reserve(despawned.size());
+	for (Engine::Entity entity : despawned)
+		despawnedIDs.push_back(entity.GetUUID());
+
+	float despawnTime = Utils::Measure([&]() { level.Scene->DestroyEntities(despawned); });
+	checkDespawned(level, despawnedIDs, "a batched mass despawn removes the subtrees and unlinks the children");
+
+	level = buildLevel();
+	despawned = selectDespawns(level);
+	despawnedIDs.clear();
+	for (Engine::Entity entity : despawned)
+		despawnedIDs.push_back(entity.GetUUID());
+
+	float despawnSingleTime = Utils::Measure([&]()
+	{
+		for (Engine::Entity entity : despawned)
+			level.Scene->DestroyEntity(entity);
+	});
+	checkDespawned(level, despawnedIDs, "despawning one at a time leaves the same scene");
+
+	// Passing an entity along with its parent destroys it once
+	level = buildLevel();
+	std::vector<Engine::Entity> overlapping = { level.Roots[0], level.Children[0], level.Roots[0] };
+	level.Scene->DestroyEntities(overlapping);
+	Check(entityCount(level) == entityTotal - (childCount + 1), "duplicates and descendants of destroyed roots are destroyed once");
+
+	Utils::LogTiming("unload (DestroyEntities)", unloadTime, entityTotal);
+	Utils::LogTiming("unload (DestroyEntity)", unloadSingleTime, entityTotal);
+	Utils::LogTiming("mass despawn (DestroyEntities)", despawnTime, entityTotal - expectedCount);
+	Utils::LogTiming("mass despawn (DestroyEntity)", despawnSingleTime, entityTotal - expectedCount);
+}
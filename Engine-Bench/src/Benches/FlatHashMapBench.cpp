@@ -0,0 +1,104 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+#include <Engine/Core/FlatHashMap.h>
+#include <Engine/Core/UUID.h>
+
+void BenchLayer::BenchFlatHashMap()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	ENGINE_CORE_INFO("FlatHashMap against std::unordered_map, UUID keys");
+
+	std::vector<Engine::UUID> keys, missing;
+	Engine::UUID::Generate(keys, m_Count);
+	Engine::UUID::Generate(missing, m_Count);
+
+	Engine::FlatHashMap<Engine::UUID, uint32_t> flat;
+	std::unordered_map<Engine::UUID, uint32_t> reference;
+
+	float flatInsert = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			flat.try_emplace(keys[i], i);
+	});
+	float referenceInsert = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			reference.try_emplace(keys[i], i);
+	});
+
+	Check(flat.size() == reference.size(), "sizes match after inserting");
+	Check(!flat.try_emplace(keys[0], 0u).second && flat.at(keys[0]) == 0, "inserting an existing key keeps its value");
+
+	// 16 slots hold 14 keys at the 7/8 load limit, the next insert grows but a lookup must not
+	std::vector<Engine::UUID> fullKeys;
+	Engine::UUID::Generate(fullKeys, 14);
+	Engine::FlatHashMap<Engine::UUID, uint32_t> full;
+	for (uint32_t i = 0; i < 14; ++i)
+		full[fullKeys[i]] = i;
+	uint32_t* firstValue = &full[fullKeys[0]];
+	full[fullKeys[13]]++;
+	Check(full.capacity() == 16 && &full[fullKeys[0]] == firstValue && *firstValue == 0, "looking up existing keys at the load limit keeps references valid");
+
+	uint64_t flatSum = 0, referenceSum = 0;
+	uint32_t flatFound = 0, referenceFound = 0;
+	float flatFind = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+		{
+			auto it = flat.find(keys[i]);
+			if (it != flat.end())
+				flatSum += it->second;
+
+			flatFound += (uint32_t)flat.count(missing[i]);
+		}
+	});
+	float referenceFind = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+		{
+			auto it = reference.find(keys[i]);
+			if (it != reference.end())
+				referenceSum += it->second;
+
+			referenceFound += (uint32_t)reference.count(missing[i]);
+		}
+	});
+
+	Check(flatSum == referenceSum, "every key finds its value");
+	Check(flatFound == 0 && referenceFound == 0, "keys never inserted aren't found");
+
+	float flatErase = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; i += 2)
+			flat.erase(keys[i]);
+	});
+	float referenceErase = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; i += 2)
+			reference.erase(keys[i]);
+	});
+
+	// Erase shifts entries back, the survivors must all still be reachable
+	bool matches = flat.size() == reference.size();
+	for (uint32_t i = 0; i < m_Count && matches; ++i)
+	{
+		auto it = reference.find(keys[i]);
+		matches = it == reference.end() ? !flat.contains(keys[i]) : flat.contains(keys[i]) && flat.at(keys[i]) == it->second;
+	}
+	Check(matches, "contents match after erasing every other key");
+
+	size_t iterated = 0;
+	for (const auto& [key, value] : flat)
+		iterated += reference.count(key);
+	Check(iterated == reference.size(), "iteration visits exactly the remaining entries");
+
+	Utils::LogTiming("insert (flat)", flatInsert, m_Count);
+	Utils::LogTiming("insert (std)", referenceInsert, m_Count);
+	Utils::LogTiming("find hit + miss (flat)", flatFind, m_Count * 2);
+	Utils::LogTiming("find hit + miss (std)", referenceFind, m_Count * 2);
+	Utils::LogTiming("erase (flat)", flatErase, m_Count / 2);
+	Utils::LogTiming("erase (std)", referenceErase, m_Count / 2);
+}
@@ -0,0 +1,180 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+void BenchLayer::BenchGroupIteration()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	ENGINE_CORE_INFO("entt groups against views with Entity::GetComponent, {} entities", m_Count);
+
+	// Mixed like a level: half sprites (a tenth of those UI), a quarter circles, a quarter bodies, every fifth entity bare
+	Engine::Ref<Engine::Scene> scene = Engine::CreateRef<Engine::Scene>("Group Bench");
+	for (uint32_t i = 0; i < m_Count; ++i)
+	{
+		Engine::Entity entity = scene->CreateEntity();
+		entity.GetComponent<Engine::TransformComponent>().Position = { (float)(i % 1000), (float)(i % 7), 0.0f };
+		if (i % 5 == 4)
+			continue;
+
+		if (i % 2 == 0)
+		{
+			entity.AddComponent<Engine::SpriteRendererComponent>().Color.a = (float)(i % 3);
+			if (i % 20 == 0)
+				entity.AddComponent<Engine::UILayoutComponent>();
+		}
+		else if (i % 4 == 1)
+		{
+			entity.AddComponent<Engine::CircleRendererComponent>().Thickness = (float)(i % 3);
+		}
+		else
+		{
+			entity.AddComponent<Engine::Rigidbody2DComponent>().FixedRotation = i % 3 == 0;
+		}
+	}
+
+	// Positions and values are small integers, so the sums are exact in any order
+	struct Result
+	{
+		uint32_t Count = 0;
+		double Sum = 0.0;
+
+		bool operator==(const Result& other) const { return Count == other.Count && Sum == other.Sum; }
+	};
+
+	const uint32_t passCount = 10;
+	auto measure = [&](auto&& iterate, Result& result)
+	{
+		return Utils::Measure([&]()
+		{
+			for (uint32_t pass = 0; pass < passCount; ++pass)
+			{
+				result = {};
+				iterate(result);
+			}
+		}) / passCount;
+	};
+
+	// The way the loops read before: a view with an exclude (here a per entity check) and Entity::GetComponent
+	auto spriteView = [&](Result& result)
+	{
+		for (auto e : scene->GetAllEntitiesWith<Engine::SpriteRendererComponent, Engine::TransformComponent, Engine::RelationshipComponent>())
+		{
+			Engine::Entity entity = { e, scene.get() };
+			if (entity.HasComponent<Engine::UILayoutComponent>())
+				continue;
+
+			result.Count++;
+			result.Sum += entity.GetComponent<Engine::TransformComponent>().Position.x + entity.GetComponent<Engine::SpriteRendererComponent>().Color.a;
+		}
+	};
+	auto spriteGroup = [&](Result& result)
+	{
+		auto group = scene->GetGroup<Engine::SpriteRendererComponent>(entt::get<Engine::TransformComponent, Engine::RelationshipComponent>, entt::exclude<Engine::UILayoutComponent>);
+		group.each([&](auto e, const auto& sprite, const auto& transform, const auto& relationship)
+		{
+			result.Count++;
+			result.Sum += transform.Position.x + sprite.Color.a;
+		});
+	};
+
+	auto circleView = [&](Result& result)
+	{
+		for (auto e : scene->GetAllEntitiesWith<Engine::CircleRendererComponent, Engine::TransformComponent, Engine::RelationshipComponent>())
+		{
+			Engine::Entity entity = { e, scene.get() };
+			if (entity.HasComponent<Engine::UILayoutComponent>())
+				continue;
+
+			result.Count++;
+			result.Sum += entity.GetComponent<Engine::TransformComponent>().Position.x + entity.GetComponent<Engine::CircleRendererComponent>().Thickness;
+		}
+	};
+	auto circleGroup = [&](Result& result)
+	{
+		auto group = scene->GetGroup<Engine::CircleRendererComponent>(entt::get<Engine::TransformComponent, Engine::RelationshipComponent>, entt::exclude<Engine::UILayoutComponent>);
+		group.each([&](auto e, const auto& circle, const auto& transform, const auto& relationship)
+		{
+			result.Count++;
+			result.Sum += transform.Position.x + circle.Thickness;
+		});
+	};
+
+	auto bodyView = [&](Result& result)
+	{
+		for (auto e : scene->GetAllEntitiesWith<Engine::Rigidbody2DComponent, Engine::TransformComponent>())
+		{
+			Engine::Entity entity = { e, scene.get() };
+			result.Count++;
+			result.Sum += entity.GetComponent<Engine::TransformComponent>().Position.y + entity.GetComponent<Engine::Rigidbody2DComponent>().FixedRotation;
+		}
+	};
+	auto bodyGroup = [&](Result& result)
+	{
+		auto group = scene->GetGroup<Engine::Rigidbody2DComponent>(entt::get<Engine::TransformComponent>);
+		group.each([&](auto e, const auto& rigidbody, const auto& transform)
+		{
+			result.Count++;
+			result.Sum += transform.Position.y + rigidbody.FixedRotation;
+		});
+	};
+
+	auto uiView = [&](Result& result)
+	{
+		for (auto e : scene->GetAllEntitiesWith<Engine::UILayoutComponent, Engine::SpriteRendererComponent, Engine::TransformComponent, Engine::RelationshipComponent>())
+		{
+			Engine::Entity entity = { e, scene.get() };
+			result.Count++;
+			result.Sum += entity.GetComponent<Engine::TransformComponent>().Position.x + entity.GetComponent<Engine::SpriteRendererComponent>().Color.a;
+		}
+	};
+	auto uiGroup = [&](Result& result)
+	{
+		auto group = scene->GetGroup<>(entt::get<Engine::UILayoutComponent, Engine::SpriteRendererComponent, Engine::TransformComponent, Engine::RelationshipComponent>);
+		group.each([&](auto e, const auto& layout, const auto& sprite, const auto& transform, const auto& relationship)
+		{
+			result.Count++;
+			result.Sum += transform.Position.x + sprite.Color.a;
+		});
+	};
+
+	Result spriteViewResult, spriteGroupResult, circleViewResult, circleGroupResult, bodyViewResult, bodyGroupResult, uiViewResult, uiGroupResult;
+	float spriteViewTime = measure(spriteView, spriteViewResult);
+	float spriteGroupTime = measure(spriteGroup, spriteGroupResult);
+	float circleViewTime = measure(circleView, circleViewResult);
+	float circleGroupTime = measure(circleGroup, circleGroupResult);
+	float bodyViewTime = measure(bodyView, bodyViewResult);
+	float bodyGroupTime = measure(bodyGroup, bodyGroupResult);
+	float uiViewTime = measure(uiView, uiViewResult);
+	float uiGroupTime = measure(uiGroup, uiGroupResult);
+
+	Check(spriteGroupResult == spriteViewResult && spriteGroupResult.Count > 0, "the world sprite group visits what the view does");
+	Check(circleGroupResult == circleViewResult && circleGroupResult.Count > 0, "the world circle group visits what the view does");
+	Check(bodyGroupResult == bodyViewResult && bodyGroupResult.Count > 0, "the rigidbody group visits what the view does");
+	Check(uiGroupResult == uiViewResult && uiGroupResult.Count > 0, "the UI sprite group visits what the view does");
+
+	// Adding the excluded component moves a sprite from the world group to the UI group
+	std::vector<Engine::Entity> moved;
+	for (auto e : scene->GetGroup<Engine::SpriteRendererComponent>(entt::get<Engine::TransformComponent, Engine::RelationshipComponent>, entt::exclude<Engine::UILayoutComponent>))
+	{
+		if (moved.size() == 100)
+			break;
+		moved.push_back({ e, scene.get() });
+	}
+	for (Engine::Entity entity : moved)
+		entity.AddComponent<Engine::UILayoutComponent>();
+
+	Result spriteAfter, uiAfter;
+	spriteGroup(spriteAfter);
+	uiGroup(uiAfter);
+	Check(spriteAfter.Count == spriteGroupResult.Count - moved.size() && uiAfter.Count == uiGroupResult.Count + moved.size(), "groups follow components added after they were built");
+
+	Utils::LogTiming("sprites (view)", spriteViewTime, spriteViewResult.Count);
+	Utils::LogTiming("sprites (group)", spriteGroupTime, spriteGroupResult.Count);
+	Utils::LogTiming("circles (view)", circleViewTime, circleViewResult.Count);
+	Utils::LogTiming("circles (group)", circleGroupTime, circleGroupResult.Count);
+	Utils::LogTiming("rigidbodies (view)", bodyViewTime, bodyViewResult.Count);
+	Utils::LogTiming("rigidbodies (group)", bodyGroupTime, bodyGroupResult.Count);
+	Utils::LogTiming("UI sprites (view)", uiViewTime, uiViewResult.Count);
+	Utils::LogTiming("UI sprites (group)", uiGroupTime, uiGroupResult.Count);
+}
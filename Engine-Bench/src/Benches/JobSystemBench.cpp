@@ -0,0 +1,130 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+#include <thread>
+
+void BenchLayer::BenchJobSystem()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	ENGINE_CORE_INFO("JobSystem scheduling and scaling");
+	Engine::JobSystem::ResetStats();
+
+	// Kick and wait
+	uint32_t jobCount = std::min(m_Count, 65536u);
+	std::atomic<uint32_t> executed = 0;
+	float kickTime = Utils::Measure([&]()
+	{
+		Engine::JobCounter counter;
+		for (uint32_t i = 0; i < jobCount; ++i)
+			Engine::JobSystem::Kick([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+
+		Engine::JobSystem::Wait(counter);
+	});
+	Check(executed == jobCount, "every kicked job ran once before Wait returned");
+	Utils::LogTiming("kick + wait", kickTime, jobCount);
+
+	// Dependent jobs only start once their dependency finished
+	std::vector<uint32_t> values(64, 0);
+	uint64_t dependentSum = 0;
+	{
+		Engine::JobCounter produced, consumed;
+		for (uint32_t i = 0; i < (uint32_t)values.size(); ++i)
+			Engine::JobSystem::Kick([&values, i]() { values[i] = i + 1; }, &produced);
+
+		Engine::JobSystem::KickAfter(produced, [&]()
+		{
+			for (uint32_t value : values)
+				dependentSum += value;
+		}, &consumed);
+
+		Engine::JobSystem::Wait(consumed);
+		Check(produced.IsDone() && consumed.IsDone(), "counters are done after waiting on the dependent job");
+	}
+	Check(dependentSum == values.size() * (values.size() + 1) / 2, "KickAfter job saw every value written by its dependency");
+
+	// ParallelFor visits every index exactly once and matches a serial loop
+	std::vector<float> serial(m_Count), parallel(m_Count);
+	std::vector<uint8_t> visits(m_Count, 0);
+	auto work = [](uint32_t i) { return std::sqrt((float)i) * std::sin((float)i); };
+
+	float serialTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			serial[i] = work(i);
+	});
+
+	float parallelTime = Utils::Measure([&]()
+	{
+		Engine::JobSystem::ParallelFor(m_Count, 1024, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				parallel[i] = work(i);
+				visits[i]++;
+			}
+		});
+	});
+
+	Check(std::all_of(visits.begin(), visits.end(), [](uint8_t count) { return count == 1; }), "ParallelFor visited every index exactly once");
+	Check(serial == parallel, "ParallelFor results match the serial loop");
+	Utils::LogTiming("serial loop", serialTime, m_Count);
+	Utils::LogTiming("ParallelFor (grain 1024)", parallelTime, m_Count);
+
+	auto stats = Engine::JobSystem::GetStats();
+	Check(stats.JobsExecuted == stats.JobsKicked, "stats count every kicked job as executed");
+	ENGINE_CORE_INFO("  {} jobs kicked, {} stolen, {} ParallelFor calls", stats.JobsKicked, stats.JobsStolen, stats.ParallelForCalls);
+
+	// Scaling, the same work spread over one worker up to the default count. The main thread helps in Wait,
+	// so n workers run on n + 1 threads
+	uint32_t defaultWorkers = Engine::JobSystem::GetWorkerCount();
+	auto heavyWork = [](uint32_t i)
+	{
+		float value = (float)i;
+		for (int step = 0; step < 64; ++step)
+			value = std::sin(value) + std::sqrt(std::abs(value) + 1.0f);
+		return value;
+	};
+
+	std::vector<float> heavySerial(m_Count), heavyParallel(m_Count);
+	float heavySerialTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			heavySerial[i] = heavyWork(i);
+	});
+	Utils::LogTiming("scaling: main thread only", heavySerialTime, m_Count);
+
+	std::vector<uint32_t> workerCounts;
+	for (uint32_t workers = 1; workers < defaultWorkers; workers *= 2)
+		workerCounts.push_back(workers);
+	workerCounts.push_back(defaultWorkers);
+
+	bool scaledResults = true;
+	for (uint32_t workers : workerCounts)
+	{
+		Engine::JobSystem::Shutdown();
+		Engine::JobSystem::Init(workers);
+
+		// Coarse ranges measure the work, fine ones the cost of scheduling
+		for (uint32_t grain : { 4096u, 64u })
+		{
+			std::fill(heavyParallel.begin(), heavyParallel.end(), 0.0f);
+			float time = Utils::Measure([&]()
+			{
+				Engine::JobSystem::ParallelFor(m_Count, grain, [&](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t i = begin; i < end; ++i)
+						heavyParallel[i] = heavyWork(i);
+				});
+			});
+			scaledResults &= heavyParallel == heavySerial;
+
+			ENGINE_CORE_INFO("  scaling: {:>2} workers, grain {:>4} {:>10.3f} ms {:>6.2f}x", workers, grain, time, time > 0.0f ? heavySerialTime / time : 0.0f);
+		}
+	}
+	Check(scaledResults, "ParallelFor results match the serial loop at every worker count");
+
+	Engine::JobSystem::Shutdown();
+	Engine::JobSystem::Init();
+}
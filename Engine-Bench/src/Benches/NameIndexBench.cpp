@@ -0,0 +1,129 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+#include <Engine/Scene/EntityNameIndex.h>
+
+void BenchLayer::BenchNameIndex()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	ENGINE_CORE_INFO("EntityNameIndex against a linear scan");
+
+	// Ten entities share each name
+	uint32_t nameCount = std::max(m_Count / 10, 1u);
+	std::vector<std::string> names(m_Count);
+	for (uint32_t i = 0; i < m_Count; ++i)
+		names[i] = "Entity " + std::to_string(i % nameCount);
+
+	Engine::EntityNameIndex index;
+	float addTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			index.Add((entt::entity)i, names[i]);
+	});
+	Check(index.GetNameCount() == nameCount, "each name is stored once");
+
+	auto scanFind = [&](std::string_view name)
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+		{
+			if (names[i] == name)
+				return (entt::entity)i;
+		}
+		return (entt::entity)entt::null;
+	};
+
+	auto scanFindAll = [&](std::string_view name)
+	{
+		std::vector<entt::entity> entities;
+		for (uint32_t i = 0; i < m_Count; ++i)
+		{
+			if (names[i] == name)
+				entities.push_back((entt::entity)i);
+		}
+		return entities;
+	};
+
+	auto scanPrefix = [&](std::string_view prefix)
+	{
+		std::vector<entt::entity> entities;
+		for (uint32_t i = 0; i < m_Count; ++i)
+		{
+			if (names[i].compare(0, prefix.size(), prefix) == 0)
+				entities.push_back((entt::entity)i);
+		}
+		return entities;
+	};
+
+	// A scan per lookup is quadratic, only a sample of names is checked against it
+	uint32_t lookups = std::min(nameCount, 1000u);
+	uint32_t step = std::max(nameCount / lookups, 1u);
+
+	bool found = true;
+	uint32_t indexHits = 0;
+	float findTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < lookups; ++i)
+			indexHits += index.Find(names[i * step]) != entt::null;
+	});
+	uint32_t scanHits = 0;
+	float scanTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < lookups; ++i)
+			scanHits += scanFind(names[i * step]) != entt::null;
+	});
+
+	for (uint32_t i = 0; i < lookups && found; ++i)
+		found = index.Find(names[i * step]) == scanFind(names[i * step]) && index.FindAll(names[i * step]) == scanFindAll(names[i * step]);
+	Check(found && indexHits == scanHits, "Find and FindAll match a linear scan");
+	Check(index.Find("Missing") == entt::null && index.FindAll("Missing").empty(), "unknown names find nothing");
+
+	std::vector<entt::entity> prefixed;
+	float prefixTime = Utils::Measure([&]() { index.FindWithPrefix("Entity 1", prefixed); });
+	Check(Utils::Sorted(prefixed) == scanPrefix("Entity 1"), "FindWithPrefix matches a linear scan");
+
+	// Renamed entities move to the back of their new name's list
+	for (uint32_t i = 0; i < m_Count; i += 7)
+	{
+		std::string newName = "Renamed " + std::to_string(i % nameCount);
+		index.Rename((entt::entity)i, names[i], newName);
+		names[i] = newName;
+	}
+
+	bool renamed = true;
+	for (uint32_t i = 0; i < lookups && renamed; ++i)
+	{
+		std::string renamedName = "Renamed " + std::to_string(i * step);
+		renamed = Utils::Sorted(index.FindAll(names[i * step])) == scanFindAll(names[i * step]) && Utils::Sorted(index.FindAll(renamedName)) == scanFindAll(renamedName);
+	}
+	Check(renamed, "names match a linear scan after renaming");
+
+	// Batch remove every third entity
+	std::vector<entt::entity> removed;
+	std::vector<std::string_view> removedNames;
+	for (uint32_t i = 0; i < m_Count; i += 3)
+	{
+		removed.push_back((entt::entity)i);
+		removedNames.push_back(names[i]);
+	}
+
+	float removeTime = Utils::Measure([&]() { index.Remove(removed, removedNames); });
+	for (entt::entity entity : removed)
+		names[(uint32_t)entity].clear();
+
+	bool remaining = true;
+	for (uint32_t i = 0; i < lookups && remaining; ++i)
+		remaining = Utils::Sorted(index.FindAll("Entity " + std::to_string(i * step))) == scanFindAll("Entity " + std::to_string(i * step));
+	Check(remaining, "names match a linear scan after a batch remove");
+
+	prefixed.clear();
+	index.FindWithPrefix("Renamed", prefixed);
+	Check(Utils::Sorted(prefixed) == scanPrefix("Renamed"), "FindWithPrefix matches a linear scan after renames and removes");
+
+	Utils::LogTiming("add", addTime, m_Count);
+	Utils::LogTiming("find (index)", findTime, lookups);
+	Utils::LogTiming("find (scan)", scanTime, lookups);
+	Utils::LogTiming("prefix \"Entity 1\"", prefixTime, 1);
+	Utils::LogTiming("batch remove", removeTime, (uint32_t)removed.size());
+}
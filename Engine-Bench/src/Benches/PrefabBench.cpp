@@ -0,0 +1,114 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+#include <random>
+
+void BenchLayer::BenchPrefabPool()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	// The bullet prefab has three nodes, so each pass moves about count entities
+	uint32_t instanceCount = std::max(m_Count / 3, 1u);
+	ENGINE_CORE_INFO("Prefab spawn/despawn, {} instances", instanceCount);
+
+	Engine::Ref<Engine::Scene> scene = Engine::CreateRef<Engine::Scene>("Prefab Bench");
+	scene->OnRuntimeStart();
+
+	std::mt19937 random(36);
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+	std::vector<Engine::TransformComponent> transforms(instanceCount);
+	for (auto& transform : transforms)
+		transform.Position = { position(random), position(random), 0.0f };
+
+	auto entityCount = [&]() { return (uint32_t)scene->GetAllEntitiesWith<Engine::IDComponent>().size(); };
+	auto rootIDs = [](std::vector<Engine::Entity>& roots)
+	{
+		std::vector<Engine::UUID> ids;
+		ids.reserve(roots.size());
+		for (Engine::Entity root : roots)
+			ids.push_back(root.GetUUID());
+		std::sort(ids.begin(), ids.end());
+		return ids;
+	};
+
+	// Imports the prefab and compiles its template, neither is part of the spawn cost
+	scene->DestroyEntity(scene->InstantiatePrefab(m_PrefabHandle, 1).front());
+	Check(entityCount() == 0 && scene->GetPrefabPoolStats().InstancesPooled == 0, "destroyed instances leave nothing behind and aren't pooled");
+
+	// Reference: one instance at a time, destroyed instead of pooled
+	std::vector<Engine::Entity> singles(instanceCount);
+	float singleSpawnTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < instanceCount; ++i)
+		{
+			singles[i] = scene->CreateEntityFromPrefab(m_PrefabHandle);
+			singles[i].GetComponent<Engine::TransformComponent>() = transforms[i];
+		}
+	});
+	Check(entityCount() == instanceCount * 3, "single spawns create every node");
+
+	float singleDestroyTime = Utils::Measure([&]()
+	{
+		for (Engine::Entity root : singles)
+			scene->DestroyEntity(root);
+	});
+	Check(entityCount() == 0, "single destroys remove every node");
+
+	// Cold: the pool is empty, every instance is built from the template
+	auto stats = scene->GetPrefabPoolStats();
+	std::vector<Engine::Entity> roots;
+	float coldSpawnTime = Utils::Measure([&]()
+	{
+		roots = scene->InstantiatePrefab(m_PrefabHandle, instanceCount, transforms.data());
+	});
+	Check(roots.size() == instanceCount && entityCount() == instanceCount * 3, "a batched spawn creates every node of every instance");
+	Check(scene->GetPrefabPoolStats().InstancesRecycled == stats.InstancesRecycled, "a cold spawn recycles nothing");
+
+	bool placed = true;
+	for (uint32_t i = 0; i < instanceCount && placed; ++i)
+	{
+		placed = roots[i].GetComponent<Engine::TransformComponent>().Position == transforms[i].Position
+			&& roots[i].GetComponent<Engine::RelationshipComponent>().ChildrenCount == 2;
+	}
+	Check(placed, "instances get their root transform and both children");
+
+	std::vector<Engine::UUID> spawnedIDs = rootIDs(roots);
+	float despawnTime = Utils::Measure([&]()
+	{
+		for (Engine::Entity root : roots)
+			scene->DespawnPrefabInstance(root);
+	});
+	Check(entityCount() == 0 && scene->GetPrefabPoolStats().InstancesPooled == instanceCount, "despawned instances leave the scene and wait in the pool");
+
+	// Recycled: every instance comes back out of the pool with its UUIDs and script instances
+	stats = scene->GetPrefabPoolStats();
+	float recycledSpawnTime = Utils::Measure([&]()
+	{
+		roots = scene->InstantiatePrefab(m_PrefabHandle, instanceCount, transforms.data());
+	});
+	Check(entityCount() == instanceCount * 3, "a recycled spawn creates every node of every instance");
+	Check(scene->GetPrefabPoolStats().InstancesRecycled - stats.InstancesRecycled == instanceCount && scene->GetPrefabPoolStats().InstancesPooled == 0,
+		"a warm spawn empties the pool");
+	Check(rootIDs(roots) == spawnedIDs, "recycled instances keep their UUIDs");
+
+	// Reordered children no longer line up with the template, that instance is destroyed instead of pooled
+	Engine::Entity reordered = roots.back();
+	roots.pop_back();
+	Engine::UUID reorderedID = reordered.GetUUID();
+	reordered.AddChild(scene->GetEntityWithUUID(reordered.GetComponent<Engine::RelationshipComponent>().FirstChild));
+	scene->DespawnPrefabInstance(reordered);
+	Check(!scene->DoesEntityExist(reorderedID) && scene->GetPrefabPoolStats().InstancesPooled == 0, "instances that don't match their template aren't pooled");
+
+	for (Engine::Entity root : roots)
+		scene->DespawnPrefabInstance(root);
+	Check(entityCount() == 0 && scene->GetPrefabPoolStats().InstancesPooled == instanceCount - 1, "matching instances are pooled again");
+
+	scene->OnRuntimeStop();
+
+	Utils::LogTiming("CreateEntityFromPrefab", singleSpawnTime, instanceCount);
+	Utils::LogTiming("DestroyEntity", singleDestroyTime, instanceCount);
+	Utils::LogTiming("InstantiatePrefab cold", coldSpawnTime, instanceCount);
+	Utils::LogTiming("DespawnPrefabInstance", despawnTime, instanceCount);
+	Utils::LogTiming("InstantiatePrefab recycled", recycledSpawnTime, instanceCount);
+}
@@ -0,0 +1,53 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+void BenchLayer::BenchSceneCatalog()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	const uint32_t entitiesPerScene = m_SceneEntityCount + m_SceneEntityCount / 10;
+	ENGINE_CORE_INFO("RuntimeSceneManager startup from the generated pak, {} scenes of {} entities", m_SceneNames.size(), entitiesPerScene);
+
+	auto loadedSceneCount = [&]()
+	{
+		uint32_t loaded = 0;
+		for (const auto& [handle, name] : m_SceneNames)
+			loaded += Engine::AssetManager::IsAssetLoaded(handle);
+		return loaded;
+	};
+	Check(loadedSceneCount() == 0, "loading the project imports no scenes");
+
+	// Catalog: names from the pak's table of contents
+	Engine::Ref<Engine::RuntimeSceneManager> sceneManager;
+	float catalogTime = Utils::Measure([&]() { sceneManager = Engine::CreateRef<Engine::RuntimeSceneManager>(); });
+	Check(loadedSceneCount() == 0, "building the catalog imports no scenes");
+	Check(sceneManager->GetSceneMap() == m_SceneNames, "the catalog lists every scene by name");
+
+	// Only the scene asked for is imported
+	Engine::AssetHandle first = m_SceneNames.begin()->first;
+	float loadTime = Utils::Measure([&]() { sceneManager->LoadScene(first); });
+	Check(loadedSceneCount() == 1 && Engine::AssetManager::IsAssetLoaded(first), "LoadScene imports only its scene");
+	Check(sceneManager->GetActiveScene()->GetAllEntitiesWith<Engine::IDComponent>().size() == entitiesPerScene, "the loaded scene has every entity");
+	sceneManager->GetActiveScene()->OnRuntimeStop();
+
+	// Reference: what the constructor did before, import every scene to read its name
+	Engine::AssetMap scenes;
+	float eagerTime = Utils::Measure([&]()
+	{
+		scenes = Engine::Project::GetActive()->GetRuntimeAssetManager()->GetAssetsOfType(Engine::AssetType::Scene);
+	});
+
+	bool matches = scenes.size() == m_SceneNames.size();
+	for (const auto& [handle, asset] : scenes)
+	{
+		auto scene = Engine::As<Engine::Scene>(asset);
+		matches = matches && m_SceneNames.count(handle) && scene->GetSceneName() == m_SceneNames.at(handle)
+			&& scene->GetAllEntitiesWith<Engine::IDComponent>().size() == entitiesPerScene;
+	}
+	Check(matches, "importing every scene finds the catalog's names and entities");
+
+	Utils::LogTiming("catalog (RuntimeSceneManager)", catalogTime, (uint32_t)m_SceneNames.size());
+	Utils::LogTiming("LoadScene (one scene)", loadTime, 1);
+	Utils::LogTiming("import every scene", eagerTime, (uint32_t)m_SceneNames.size());
+}
@@ -0,0 +1,160 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+#include <Engine/Scene/SpatialIndex.h>
+#include <random>
+
+void BenchLayer::BenchSpatialIndex()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	ENGINE_CORE_INFO("SpatialIndex against brute force");
+
+	struct Bounds
+	{
+		glm::vec2 Min, Max;
+	};
+
+	std::mt19937 random(31);
+	std::uniform_real_distribution<float> position(-500.0f, 500.0f), size(0.1f, 3.0f), offset(-2.0f, 2.0f);
+
+	std::vector<Bounds> bounds(m_Count);
+	for (uint32_t i = 0; i < m_Count; ++i)
+	{
+		glm::vec2 min = { position(random), position(random) };
+		// Every thousandth entity spans far more cells than it's worth listing
+		glm::vec2 extent = i % 1000 == 0 ? glm::vec2(200.0f) : glm::vec2(size(random), size(random));
+		bounds[i] = { min, min + extent };
+	}
+
+	Engine::SpatialIndex index;
+	float insertTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			index.Update((entt::entity)i, bounds[i].Min, bounds[i].Max);
+	});
+
+	auto stats = index.GetStats();
+	Check(stats.EntityCount == m_Count, "every entity is indexed");
+	Check(stats.OversizedCount > 0, "large bounds are kept out of the grid");
+
+	auto overlaps = [](const Bounds& entity, const glm::vec2& min, const glm::vec2& max)
+	{
+		return entity.Min.x <= max.x && entity.Max.x >= min.x && entity.Min.y <= max.y && entity.Max.y >= min.y;
+	};
+
+	auto bruteRegion = [&](const glm::vec2& min, const glm::vec2& max)
+	{
+		std::vector<entt::entity> entities;
+		for (uint32_t i = 0; i < m_Count; ++i)
+		{
+			if (overlaps(bounds[i], min, max))
+				entities.push_back((entt::entity)i);
+		}
+		return entities;
+	};
+
+	auto bruteRadius = [&](const glm::vec2& center, float radius)
+	{
+		std::vector<entt::entity> entities;
+		for (uint32_t i = 0; i < m_Count; ++i)
+		{
+			glm::vec2 closest = glm::clamp(center, bounds[i].Min, bounds[i].Max);
+			if (glm::dot(closest - center, closest - center) <= radius * radius)
+				entities.push_back((entt::entity)i);
+		}
+		return entities;
+	};
+
+	const uint32_t queryCount = 256;
+	std::vector<glm::vec2> centers(queryCount);
+	for (glm::vec2& center : centers)
+		center = { position(random), position(random) };
+
+	bool regions = true, points = true, radii = true;
+	for (const glm::vec2& center : centers)
+	{
+		std::vector<entt::entity> entities;
+		index.QueryRegion(center - 10.0f, center + 10.0f, entities);
+		regions &= Utils::Sorted(entities) == bruteRegion(center - 10.0f, center + 10.0f);
+
+		entities.clear();
+		index.QueryPoint(center, entities);
+		points &= Utils::Sorted(entities) == bruteRegion(center, center);
+
+		entities.clear();
+		index.QueryRadius(center, 10.0f, entities);
+		radii &= Utils::Sorted(entities) == bruteRadius(center, 10.0f);
+	}
+	Check(regions, "QueryRegion matches brute force");
+	Check(points, "QueryPoint matches brute force");
+	Check(radii, "QueryRadius matches brute force");
+
+	size_t indexResults = 0, bruteResults = 0;
+	float queryTime = Utils::Measure([&]()
+	{
+		std::vector<entt::entity> entities;
+		for (const glm::vec2& center : centers)
+		{
+			entities.clear();
+			index.QueryRadius(center, 10.0f, entities);
+			indexResults += entities.size();
+		}
+	});
+	float bruteTime = Utils::Measure([&]()
+	{
+		for (const glm::vec2& center : centers)
+			bruteResults += bruteRadius(center, 10.0f).size();
+	});
+
+	// Queries are const, they may run on every worker at once
+	std::vector<size_t> parallelResults(queryCount, 0);
+	Engine::JobSystem::ParallelFor(queryCount, 16, [&](uint32_t begin, uint32_t end)
+	{
+		std::vector<entt::entity> entities;
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			entities.clear();
+			index.QueryRadius(centers[i], 10.0f, entities);
+			parallelResults[i] = entities.size();
+		}
+	});
+	Check(std::accumulate(parallelResults.begin(), parallelResults.end(), (size_t)0) == indexResults, "concurrent queries match serial ones");
+
+	// Move everything a little, most entities stay in their cells
+	index.ResetStats();
+	for (Bounds& entity : bounds)
+	{
+		glm::vec2 move = { offset(random), offset(random) };
+		entity.Min += move;
+		entity.Max += move;
+	}
+
+	float updateTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			index.Update((entt::entity)i, bounds[i].Min, bounds[i].Max);
+	});
+	uint32_t cellChanges = index.GetStats().CellChanges;
+
+	for (uint32_t i = 0; i < m_Count; i += 2)
+		index.Remove((entt::entity)i);
+	for (uint32_t i = 0; i < m_Count; i += 2)
+		bounds[i] = { glm::vec2(10000.0f), glm::vec2(10000.0f) };
+
+	bool moved = true;
+	for (uint32_t i = 0; i < 32 && moved; ++i)
+	{
+		std::vector<entt::entity> entities;
+		index.QueryRadius(centers[i], 10.0f, entities);
+		moved = Utils::Sorted(entities) == bruteRadius(centers[i], 10.0f);
+	}
+	Check(moved, "queries match brute force after moving and removing entities");
+
+	Utils::LogTiming("insert", insertTime, m_Count);
+	Utils::LogTiming("update (small moves)", updateTime, m_Count);
+	Utils::LogTiming("radius 10 query (index)", queryTime, queryCount);
+	Utils::LogTiming("radius 10 query (brute force)", bruteTime, queryCount);
+	ENGINE_CORE_INFO("  {} cells, {} oversized, {} cell changes on update", stats.CellCount, stats.OversizedCount, cellChanges);
+}
@@ -0,0 +1,90 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+#include <random>
+
+void BenchLayer::BenchTransformCache()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	ENGINE_CORE_INFO("Transform cache");
+
+	std::mt19937 random(42);
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f), angle(-glm::pi<float>(), glm::pi<float>()), scale(0.5f, 2.0f);
+
+	std::vector<Engine::TransformComponent> transforms(m_Count);
+	for (uint32_t i = 0; i < m_Count; ++i)
+	{
+		auto& transform = transforms[i];
+		transform.Position = { position(random), position(random), 0.0f };
+		// A quarter rotate around every axis and take the quaternion path
+		transform.Rotation = i % 4 == 0 ? glm::vec3(angle(random), angle(random), angle(random)) : glm::vec3(0.0f, 0.0f, angle(random));
+		transform.Scale = { scale(random), scale(random), 1.0f };
+	}
+
+	auto reference = [](const Engine::TransformComponent& transform)
+	{
+		return glm::translate(glm::mat4(1.0f), transform.Position) * glm::toMat4(glm::quat(transform.Rotation)) * glm::scale(glm::mat4(1.0f), transform.Scale);
+	};
+
+	// Nothing refreshed yet, every read builds its own matrix
+	std::vector<glm::mat4> uncached(m_Count);
+	float uncachedTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			uncached[i] = transforms[i].GetTransform();
+	});
+
+	float maxError = 0.0f;
+	for (uint32_t i = 0; i < m_Count; ++i)
+	{
+		glm::mat4 expected = reference(transforms[i]);
+		for (int column = 0; column < 4; ++column)
+		{
+			for (int row = 0; row < 4; ++row)
+				maxError = std::max(maxError, glm::abs(uncached[i][column][row] - expected[column][row]));
+		}
+	}
+	Check(maxError < 1e-4f, "built matrices match translate * rotate * scale");
+
+	float refreshTime = Utils::Measure([&]()
+	{
+		for (auto& transform : transforms)
+			transform.RefreshCache();
+	});
+
+	std::vector<glm::mat4> cached(m_Count);
+	float cachedTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < m_Count; ++i)
+			cached[i] = transforms[i].GetTransform();
+	});
+	Check(cached == uncached, "cached matrices equal the ones built on read");
+
+	// Const reads never write the cache, several workers can read the same transforms at once
+	std::vector<glm::vec3> serialUp(m_Count), parallelUp(m_Count);
+	transforms[0].Position.x += 1.0f;
+	for (uint32_t i = 0; i < m_Count; ++i)
+		serialUp[i] = transforms[i].Up() + glm::vec3(transforms[i].GetTransform()[3]);
+
+	Engine::JobSystem::ParallelFor(m_Count, 256, [&](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			const Engine::TransformComponent& transform = transforms[(i * 7919u) % m_Count];
+			parallelUp[(i * 7919u) % m_Count] = transform.Up() + glm::vec3(transform.GetTransform()[3]);
+		}
+	});
+	Check(serialUp == parallelUp, "concurrent reads, including a stale cache, match serial ones");
+
+	// Editing a field bypasses the cache until the next refresh
+	transforms[1].Position.y += 5.0f;
+	glm::mat4 stale = transforms[1].GetTransform();
+	transforms[1].RefreshCache();
+	Check(stale == transforms[1].GetTransform() && stale[3].y == transforms[1].Position.y, "a stale cache is bypassed and refreshed to the same matrix");
+
+	Utils::LogTiming("GetTransform (uncached)", uncachedTime, m_Count);
+	Utils::LogTiming("RefreshCache", refreshTime, m_Count);
+	Utils::LogTiming("GetTransform (cached)", cachedTime, m_Count);
+}
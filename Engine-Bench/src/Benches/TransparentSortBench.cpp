@@ -0,0 +1,84 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+#include <Platform/Headless/HeadlessCommandLog.h>
+#include <random>
+
+void BenchLayer::BenchTransparentSort()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	// Needs the headless backend the app starts with, draws are recorded instead of sent to a GPU
+	uint32_t spriteCount = std::max(m_Count / 2, 1u);
+	ENGINE_CORE_INFO("Renderer2D transparent sorting, {} translucent sprites", spriteCount);
+
+	std::mt19937 random(28);
+	std::uniform_real_distribution<float> position(-90.0f, 90.0f), depth(-0.9f, 0.9f), alpha(0.1f, 0.9f);
+
+	struct Sprite
+	{
+		glm::vec3 Position;
+		glm::vec4 Color;
+	};
+
+	std::vector<Sprite> sprites(spriteCount);
+	for (Sprite& sprite : sprites)
+		sprite = { { position(random), position(random), depth(random) }, { 1.0f, 0.5f, 0.25f, alpha(random) } };
+
+	const glm::mat4 viewProjection = glm::ortho(-100.0f, 100.0f, -100.0f, 100.0f, -1.0f, 1.0f);
+	const uint32_t frameCount = 10;
+	bool previousSorting = Engine::Renderer2D::GetTransparentSorting();
+
+	// Every other sprite made opaque, those stay in the unsorted batch
+	auto drawFrames = [&](bool sorting, bool mixed)
+	{
+		Engine::Renderer2D::SetTransparentSorting(sorting);
+		Engine::Renderer2D::ResetStats();
+		Engine::HeadlessCommandLog::Reset();
+
+		float time = Utils::Measure([&]()
+		{
+			for (uint32_t frame = 0; frame < frameCount; ++frame)
+			{
+				Engine::Renderer2D::BeginScene(viewProjection);
+				for (uint32_t i = 0; i < spriteCount; ++i)
+				{
+					glm::vec4 color = sprites[i].Color;
+					if (mixed && i % 2 == 0)
+						color.a = 1.0f;
+					Engine::Renderer2D::DrawQuad(sprites[i].Position, 0.0f, glm::vec2(2.0f), color);
+				}
+				Engine::Renderer2D::EndScene();
+			}
+		});
+
+		return time / frameCount;
+	};
+
+	float unsortedTime = drawFrames(false, false);
+	auto unsortedStats = Engine::Renderer2D::GetStats();
+	auto unsortedCommands = Engine::HeadlessCommandLog::GetStats();
+
+	float sortedTime = drawFrames(true, false);
+	auto sortedStats = Engine::Renderer2D::GetStats();
+	auto sortedCommands = Engine::HeadlessCommandLog::GetStats();
+
+	float mixedTime = drawFrames(true, true);
+	auto mixedStats = Engine::Renderer2D::GetStats();
+	auto mixedCommands = Engine::HeadlessCommandLog::GetStats();
+
+	Engine::Renderer2D::SetTransparentSorting(previousSorting);
+
+	Check(unsortedStats.TransparentQuadCount == 0, "nothing is deferred with sorting off");
+	Check(sortedStats.TransparentQuadCount == spriteCount * frameCount, "every translucent sprite goes through the sorted pass");
+	Check(mixedStats.TransparentQuadCount == (spriteCount / 2) * frameCount, "opaque sprites keep the unsorted batch");
+	Check(unsortedCommands.IndicesDrawn == sortedCommands.IndicesDrawn && sortedCommands.IndicesDrawn == mixedCommands.IndicesDrawn
+		&& sortedCommands.IndicesDrawn == (uint64_t)spriteCount * 6 * frameCount, "every sprite reaches the backend exactly once in each mode");
+
+	Utils::LogTiming("frame, sorting off", unsortedTime, spriteCount);
+	Utils::LogTiming("frame, sorting on", sortedTime, spriteCount);
+	Utils::LogTiming("sort only", sortedStats.TransparentSortTime / frameCount, spriteCount);
+	Utils::LogTiming("frame, half opaque", mixedTime, spriteCount);
+	ENGINE_CORE_INFO("  draw calls per frame: {} off, {} on, {} half opaque", unsortedCommands.DrawCalls / frameCount, sortedCommands.DrawCalls / frameCount, mixedCommands.DrawCalls / frameCount);
+}
@@ -0,0 +1,76 @@
+#include <enginepch.h>
+#include "BenchLayer.h"
+#include "BenchUtils.h"
+
+#include <Engine/Core/UUID.h>
+#include <unordered_set>
+
+void BenchLayer::BenchUUID()
+{
+	ENGINE_PROFILE_FUNCTION();
+
+	ENGINE_CORE_INFO("UUID generation across {} threads", Engine::JobSystem::GetWorkerCount() + 1);
+
+	// Each job fills its own list, half one at a time and half in batches of mixed sizes
+	uint32_t jobCount = (Engine::JobSystem::GetWorkerCount() + 1) * 4;
+	uint32_t perJob = std::max(m_Count / jobCount, 1u);
+	std::vector<std::vector<Engine::UUID>> generated(jobCount);
+
+	float generateTime = Utils::Measure([&]()
+	{
+		Engine::JobCounter counter;
+		for (uint32_t job = 0; job < jobCount; ++job)
+		{
+			Engine::JobSystem::Kick([&generated, job, perJob]()
+			{
+				auto& uuids = generated[job];
+				uuids.reserve(perJob);
+				if (job % 2 == 0)
+				{
+					for (uint32_t i = 0; i < perJob; ++i)
+						uuids.emplace_back();
+					return;
+				}
+
+				const size_t batchSizes[] = { 1, 16, 1000, 4096 };
+				for (uint32_t i = 0; uuids.size() < perJob; ++i)
+					Engine::UUID::Generate(uuids, std::min(batchSizes[i % 4], perJob - uuids.size()));
+			}, &counter);
+		}
+
+		Engine::JobSystem::Wait(counter);
+	});
+
+	std::unordered_set<uint64_t> unique;
+	unique.reserve((size_t)jobCount * perJob);
+	size_t total = 0, invalid = 0;
+	for (auto& uuids : generated)
+	{
+		for (Engine::UUID& uuid : uuids)
+		{
+			invalid += !uuid.IsValid();
+			unique.insert(uuid);
+		}
+		total += uuids.size();
+	}
+
+	Check(total == (size_t)jobCount * perJob, "every job generated its IDs");
+	Check(invalid == 0, "no generated ID is invalid");
+	Check(unique.size() == total, "no ID was generated twice across threads");
+
+	float singleTime = Utils::Measure([&]()
+	{
+		for (uint32_t i = 0; i < perJob; ++i)
+			unique.insert(Engine::UUID());
+	});
+	std::vector<Engine::UUID> batch;
+	float batchTime = Utils::Measure([&]() { Engine::UUID::Generate(batch, perJob); });
+	for (Engine::UUID uuid : batch)
+		unique.insert(uuid);
+	Check(unique.size() == total + perJob * 2, "IDs from the main thread don't collide with the workers' IDs");
+
+	Utils::LogTiming("generate (all threads)", generateTime, (uint32_t)total);
+	Utils::LogTiming("UUID() + set insert", singleTime, perJob);
+	Utils::LogTiming("Generate batch", batchTime, perJob);
+	ENGINE_CORE_INFO("  {} unique IDs", unique.size());
+}
@@ -208,6 +208,8 @@ namespace Engine
 					m_ShowProjectSettingsWindow = true;
 				if (ImGui::MenuItem("Asset Manager Stats"))
 					m_ShowAssetManagerWindow = true;
+				if (ImGui::MenuItem("ECS Profiler"))
+					m_ShowECSProfilerWindow = true;
 
 				ImGui::EndMenu();
 			}
@@ -257,6 +259,29 @@ namespace Engine
 		ImGui::Text("Quad Count: %d", stats.QuadCount);
 		ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
 		ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+		ImGui::Text("Tilemap Chunks: %d drawn, %d culled", stats.TilemapChunksDrawn, stats.TilemapChunksCulled);
+
+		bool transparentSorting = Renderer2D::GetTransparentSorting();
+		if (ImGui::Checkbox("Sort Transparent Sprites", &transparentSorting))
+			Renderer2D::SetTransparentSorting(transparentSorting);
+		ImGui::Text("Transparent Quads: %d (sort %.3fms)", stats.TransparentQuadCount, stats.TransparentSortTime);
+
+		if (Ref<Scene> activeScene = SceneManager::GetActiveScene())
+		{
+			auto& systemScheduler = activeScene->GetSystemScheduler();
+			auto systemStats = systemScheduler.GetStats();
+			ImGui::Separator();
+			ImGui::Text("Scene Systems: %d (%.3fms, critical path %d)", systemStats.SystemsRun, systemStats.TotalTime, systemStats.CriticalPathLength);
+			for (const auto& system : systemScheduler.GetSystems())
+				ImGui::Text("  %s: %.3fms%s", system.Name.c_str(), system.LastTime, system.MainThread ? " (main)" : "");
+
+			auto prefabStats = activeScene->GetPrefabPoolStats();
+			ImGui::Text("Prefab Instances: %d spawned, %d recycled", prefabStats.InstancesSpawned, prefabStats.InstancesRecycled);
+			ImGui::Text("Prefab Pool: %d despawned, %d pooled", prefabStats.InstancesDespawned, prefabStats.InstancesPooled);
+
+			auto spatialStats = activeScene->GetSpatialIndex().GetStats();
+			ImGui::Text("Spatial Index: %d entities, %d cells, %d oversized, %d cell changes", spatialStats.EntityCount, spatialStats.CellCount, spatialStats.OversizedCount, spatialStats.CellChanges);
+		}
 
 		ImGui::End();
 
@@ -481,6 +506,108 @@ namespace Engine
 			ImGui::End();
 		}
 
+		if (m_ShowECSProfilerWindow)
+		{
+			ImGui::Begin("ECS Profiler", &m_ShowECSProfilerWindow);
+
+			if (Ref<Scene> activeScene = SceneManager::GetActiveScene())
+			{
+				ECSProfiler& profiler = activeScene->GetECSProfiler();
+				auto memoryStats = activeScene->GetECSMemoryStats();
+
+				bool enabled = profiler.IsEnabled();
+				if (ImGui::Checkbox("Time Views", &enabled))
+					profiler.SetEnabled(enabled);
+				ImGui::SameLine();
+				if (ImGui::Button("Reset"))
+					profiler.ResetViewStats();
+				ImGui::SameLine();
+				if (ImGui::Button("Export JSON"))
+				{
+					std::filesystem::path path = FileDialogs::SaveFile("ECS Stats (*.json)\0*.json\0");
+					if (!path.empty())
+					{
+						if (path.extension() != ".json")
+							path += ".json";
+						activeScene->ExportECSStats(path);
+					}
+				}
+
+				ImGui::Text("Entities: %d alive, %d slots, %d capacity", (int)memoryStats.EntitiesAlive, (int)memoryStats.EntitySlots, (int)memoryStats.EntityCapacity);
+				ImGui::Text("Total: %.1f KB", memoryStats.GetTotalBytes() / 1024.0f);
+
+				ImGui::Separator();
+				{
+					ImGui::Text("Component Pools");
+					ImGui::BeginTable("Component Pools", 5, ImGuiTableFlags_Resizable);
+
+					ImGui::TableSetupColumn("Component");
+					ImGui::TableSetupColumn("Count");
+					ImGui::TableSetupColumn("Capacity");
+					ImGui::TableSetupColumn("Packed KB");
+					ImGui::TableSetupColumn("Sparse Pages");
+					ImGui::TableHeadersRow();
+
+					for (const auto& pool : memoryStats.Pools)
+					{
+						ImGui::TableNextRow();
+
+						ImGui::TableSetColumnIndex(0);
+						ImGui::Text(pool.Name.c_str());
+
+						ImGui::TableSetColumnIndex(1);
+						ImGui::Text("%d", (int)pool.Count);
+
+						ImGui::TableSetColumnIndex(2);
+						ImGui::Text("%d", (int)pool.Capacity);
+
+						ImGui::TableSetColumnIndex(3);
+						ImGui::Text("%.1f", pool.Bytes / 1024.0f);
+
+						ImGui::TableSetColumnIndex(4);
+						ImGui::Text("%d", (int)pool.SparsePages);
+					}
+					ImGui::EndTable();
+				}
+
+				ImGui::Separator();
+				{
+					ImGui::Text("Views");
+					ImGui::BeginTable("Views", 5, ImGuiTableFlags_Resizable);
+
+					ImGui::TableSetupColumn("View");
+					ImGui::TableSetupColumn("Entities");
+					ImGui::TableSetupColumn("Last (ms)");
+					ImGui::TableSetupColumn("Average (ms)");
+					ImGui::TableSetupColumn("Max (ms)");
+					ImGui::TableHeadersRow();
+
+					for (const auto& view : profiler.GetViewStats())
+					{
+						ImGui::TableNextRow();
+
+						ImGui::TableSetColumnIndex(0);
+						ImGui::Text(view.Name.c_str());
+
+						ImGui::TableSetColumnIndex(1);
+						ImGui::Text("%d", view.Entities);
+
+						ImGui::TableSetColumnIndex(2);
+						ImGui::Text("%.3f", view.LastTime);
+
+						ImGui::TableSetColumnIndex(3);
+						ImGui::Text("%.3f", view.AverageTime);
+
+						ImGui::TableSetColumnIndex(4);
+						ImGui::Text("%.3f", view.MaxTime);
+					}
+					ImGui::EndTable();
+				}
+			}
+
+			ImGui::End();
+		}
+
 		if (m_ShowProjectSettingsWindow)
 		{
 			ImGui::Begin("Project Settings", &m_ShowProjectSettingsWindow);
@@ -880,6 +1007,9 @@ namespace Engine
 		Entity selectedEntity = m_SceneHierarchyPanel.GetSelectedEntity();
 		bool isEntityUI = m_SceneHierarchyPanel.IsSelectedEntityValid() && selectedEntity.HasComponent<UILayoutComponent>();
 
+		// Overlay lines are quads in world units, so scale them with the editor camera zoom
+		const float lineWidth = sceneState == EditorSceneState::Play ? 0.02f : m_EditorCamera.GetDistance() * 0.002f;
+
 		if (m_ShowPhysicsColliders)
 		{
 			{ // Visualize Box Collider 2D
@@ -894,7 +1024,7 @@ namespace Engine
 
 					glm::mat4 transform = Math::GenRectTransform(position, tc.Rotation.z, scale);
 
-					Renderer2D::DrawRect(transform, glm::vec4(0, 1, 0, 1));
+					Renderer2D::DrawRectOutline(transform, glm::vec4(0, 1, 0, 1), lineWidth);
 				}
 			}
 
@@ -910,21 +1040,14 @@ namespace Engine
 
 					glm::mat4 transform = Math::GenRectTransform(position, 0, scale);
 
-					Renderer2D::DrawCircle(transform, glm::vec4(0, 1, 0, 1), 0.05f);
+					Renderer2D::DrawCircleOutline(transform, glm::vec4(0, 1, 0, 1), lineWidth);
 				}
 			}
 		}
 
 		// Draw selected entity outline
 		if (m_SceneHierarchyPanel.IsSelectedEntityValid() && !isEntityUI)
-		{
-			Renderer2D::SetLineWidth(4.0f);
-			Renderer2D::DrawRect(selectedEntity.GetWorldSpaceTransform(), glm::vec4(1, 0, 0.5f, 1));
-		}
-		else
-		{
-			Renderer2D::SetLineWidth(2.0f);
-		}
+			Renderer2D::DrawRectOutline(selectedEntity.GetWorldSpaceTransform(), glm::vec4(1, 0, 0.5f, 1), lineWidth * 2.0f);
 
 		Renderer2D::EndScene();
 
@@ -932,16 +1055,9 @@ namespace Engine
 
 		Renderer2D::BeginScene(activeScene->GetScreenCamera(), glm::mat4(1.0f));
 
-		// Draw selected entity outline
+		// Draw selected entity outline (screen camera units are pixels)
 		if (m_SceneHierarchyPanel.IsSelectedEntityValid() && isEntityUI)
-		{
-			Renderer2D::SetLineWidth(4.0f);
-			Renderer2D::DrawRect(selectedEntity.GetUISpaceTransform(), glm::vec4(1, 0, 0.5f, 1));
-		}
-		else
-		{
-			Renderer2D::SetLineWidth(2.0f);
-		}
+			Renderer2D::DrawRectOutline(selectedEntity.GetUISpaceTransform(), glm::vec4(1, 0, 0.5f, 1), 4.0f);
 
 		Renderer2D::EndScene();
 	}
@@ -1095,7 +1211,7 @@ namespace Engine
 		}
 
 		if (scene->IsRunning())
-			UIEngine::SetViewportMousePos(mouseX, mouseY);
+			UIEngine::SetViewportMousePos(scene.get(), mouseX, mouseY);
 	}
 
 	void EditorLayer::OnScenePlay()
@@ -71,6 +71,7 @@ namespace Engine
 		bool m_ShowPhysicsColliders = true;
 
 		bool m_ShowAssetManagerWindow = false;
+		bool m_ShowECSProfilerWindow = false;
 		bool m_ShowSpriteWindow = false;
 		bool m_ShowProjectSettingsWindow = false;
 
@@ -559,7 +559,11 @@ namespace Engine
 	void SceneHierarchyPanel::DrawComponents(Entity entity)
 	{
 		if (entity.HasComponent<TagComponent>())
-			ImGui::InputText("##Tag", &entity.GetComponent<TagComponent>().Tag);
+		{
+			std::string name = entity.GetName();
+			if (ImGui::InputText("##Tag", &name))
+				entity.SetName(name);
+		}
 
 		// Draw Add Component Button at the top right next to the tag input field.
 		ImGui::SameLine();
@@ -573,6 +577,7 @@ namespace Engine
 			DisplayAddComponentEntry<SpriteRendererComponent>("Sprite Renderer");
 			DisplayAddComponentEntry<CircleRendererComponent>("Circle Renderer");
 			DisplayAddComponentEntry<TextRendererComponent>("Text Renderer");
+			DisplayAddComponentEntry<TilemapComponent>("Tilemap");
 			DisplayAddComponentEntry<UILayoutComponent>("UI Layout Component");
 			DisplayAddComponentEntry<UIButtonComponent>("UI Button Component");
 			DisplayAddComponentEntry<Rigidbody2DComponent>("Rigidbody 2D");
@@ -775,6 +780,60 @@ namespace Engine
 			ImGui::DragFloat("Line Spacing", &component.LineSpacing, 0.01f);
 		});
 
+		DrawComponent<TilemapComponent>("Tilemap", entity, [](auto& component)
+		{
+			ImGui::ColorEdit4("Color", glm::value_ptr(component.Color));
+
+			ImGui::Text("Tileset");
+			ImGui::SameLine();
+
+			std::string tilesetName = "None";
+			if (component.Tileset.IsValid())
+			{
+				if (AssetManager::IsAssetHandleValid(component.Tileset))
+					tilesetName = Project::GetActive()->GetEditorAssetManager()->GetAssetPath(component.Tileset).filename().string();
+				else
+					tilesetName = "Invalid";
+			}
+
+			ImGui::Button(tilesetName.c_str());
+
+			if (ImGui::BeginDragDropTarget())
+			{
+				if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("CONTENT_BROWSER_ITEM"))
+				{
+					AssetHandle handle = *(AssetHandle*)payload->Data;
+					if (AssetManager::IsAssetHandleValid(handle) && Project::GetActive()->GetEditorAssetManager()->GetAssetType(handle) == AssetType::Texture2D)
+					{
+						component.Tileset = handle;
+						component.MarkAllDirty();
+					}
+					else
+					{
+						ENGINE_CORE_WARN("Asset was not a valid texture!");
+					}
+				}
+
+				ImGui::EndDragDropTarget();
+			}
+
+			bool meshInvalidated = false;
+			if (ImGui::DragFloat2("Tileset Cell Size", glm::value_ptr(component.TilesetCellSize), 1.0f, 1.0f, std::numeric_limits<float>().max(), "%.0f"))
+				meshInvalidated = true;
+			if (ImGui::DragFloat2("Tile Size", glm::value_ptr(component.TileSize), 0.1f, 0.01f, std::numeric_limits<float>().max()))
+				meshInvalidated = true;
+			if (meshInvalidated)
+				component.MarkAllDirty();
+
+			ImGui::Separator();
+			ImGui::Checkbox("Generate Colliders", &component.GenerateColliders);
+			ImGui::DragFloat("Friction", &component.Friction, 0.01f, 0.0f, 1.0f);
+			ImGui::DragFloat("Restitution", &component.Restitution, 0.01f, 0.0f, 1.0f);
+
+			ImGui::Separator();
+			ImGui::Text("Chunks: %d (%dx%d tiles each)", (int)component.Chunks.size(), TilemapComponent::ChunkSize, TilemapComponent::ChunkSize);
+		});
+
 		DrawComponent<UIButtonComponent>("UI Button", entity, [&](auto& component)
 		{
 			ImGui::Checkbox("Intractable", &component.ButtonState.Interactable);
@@ -0,0 +1,42 @@
+#include <Engine.h>
+#include <Engine/Core/EntryPoint.h>
+
+#include "HeadlessRunnerLayer.h"
+
+class HeadlessApp : public Engine::Application
+{
+public:
+	HeadlessApp(const Engine::ApplicationSpecification& specification)
+		: Engine::Application(specification)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		PushLayer(new HeadlessRunner());
+	}
+
+	~HeadlessApp()
+	{
+		ENGINE_PROFILE_FUNCTION();
+	}
+};
+
+Engine::Application* Engine::CreateApplication(Engine::ApplicationCommandLineArgs args)
+{
+	ApplicationSpecification spec;
+	spec.Name = "Engine-Headless";
+#if ENGINE_DIST
+	spec.WorkingDirectory = "";
+#else
+	spec.WorkingDirectory = "../Engine-Editor";
+#endif
+	spec.CommandLineArgs = args;
+	spec.Headless = true;
+
+	for (int i = 1; i < args.Count - 1; ++i)
+	{
+		if (std::string(args[i]) == "--timestep")
+			spec.FixedTimestep = std::stof(args[i + 1]);
+	}
+
+	return new HeadlessApp(spec);
+}
@@ -0,0 +1,266 @@
+#include <enginepch.h>
+#include "HeadlessRunnerLayer.h"
+
+void HeadlessRunner::OnAttach()
+{
+	if (!ParseCommandLineArgs())
+	{
+		ENGINE_CORE_ERROR("Usage: Engine-Headless <project> [--scene <handle>] [--steps <count>] [--sessions <count>] [--instances <count>] [--timestep <seconds>] [--ecs-stats <json path>] [--snapshots <frames>] [--render-thread <0|1>]");
+		Engine::Application::Get().Close();
+		return;
+	}
+
+	if (!Engine::Project::Load(m_ProjectPath))
+	{
+		ENGINE_CORE_ERROR("Didn't load valid project, closing.");
+		Engine::Application::Get().Close();
+		return;
+	}
+
+	if (m_SceneHandle == 0)
+		m_SceneHandle = Engine::Project::GetActive()->GetConfig().RuntimeStartScene;
+
+	if (Engine::SceneManager::GetSceneMap().find(m_SceneHandle) == Engine::SceneManager::GetSceneMap().end())
+	{
+		ENGINE_CORE_ERROR("Scene {} isn't in the project, closing.", m_SceneHandle);
+		Engine::Application::Get().Close();
+		return;
+	}
+
+	ENGINE_CORE_INFO("Headless run: scene {}, {} sessions of {} steps at {}s, {} instances", m_SceneHandle, m_SessionCount, m_StepsPerSession,
+		Engine::Application::Get().GetSpecification().FixedTimestep, m_InstanceCount);
+
+	// The headless renderer has no graphics context, so its commands can be recorded from any one thread
+	if (m_UseRenderThread)
+		m_RenderThread.Start([](const Engine::RenderSnapshot& snapshot) { snapshot.Submit(); });
+
+	StartSession();
+}
+
+void HeadlessRunner::OnUpdate(Engine::Timestep ts)
+{
+	if (!m_Running)
+		return;
+
+	if (m_Instances.empty())
+	{
+		// Async loads swap or merge scenes here, between updates
+		Engine::SceneManager::UpdateSceneLoading();
+
+		// Scripts may load another scene mid session, always step whichever is active
+		Engine::SceneManager::GetActiveScene()->SimulateRuntime(ts);
+	}
+	else
+	{
+		Engine::JobCounter counter;
+		for (const auto& scene : m_Instances)
+			Engine::JobSystem::Kick([scene, ts]() { scene->SimulateRuntime(ts); }, &counter);
+		Engine::JobSystem::Wait(counter);
+	}
+
+	if (m_UseRenderThread)
+		ExtractRenderSnapshot();
+
+	if (++m_Step < m_StepsPerSession)
+		return;
+
+	EndSession();
+
+	if (++m_Session < m_SessionCount)
+	{
+		StartSession();
+		return;
+	}
+
+	m_Running = false;
+	m_RenderThread.Stop();
+
+	// Exported before stopping, the pools still hold the runtime state
+	if (!m_ECSStatsPath.empty())
+	{
+		auto scene = m_Instances.empty() ? Engine::SceneManager::GetActiveScene() : m_Instances.front();
+		if (scene->ExportECSStats(m_ECSStatsPath))
+			ENGINE_CORE_INFO("ECS stats written to {}", m_ECSStatsPath.string());
+	}
+
+	if (m_Instances.empty())
+		Engine::SceneManager::GetActiveScene()->OnRuntimeStop();
+	else
+		StopInstances();
+
+	ENGINE_CORE_INFO("Headless run finished: {} steps in {:.3f}s, {:.0f} steps/s", m_TotalSteps, m_TotalTime, m_TotalSteps / m_TotalTime);
+	Engine::Application::Get().Close();
+}
+
+bool HeadlessRunner::ParseCommandLineArgs()
+{
+	auto commandLineArgs = Engine::Application::Get().GetSpecification().CommandLineArgs;
+	if (commandLineArgs.Count < 2)
+		return false;
+
+	m_ProjectPath = commandLineArgs[1];
+
+	for (int i = 2; i < commandLineArgs.Count; ++i)
+	{
+		std::string arg = commandLineArgs[i];
+		if (i + 1 >= commandLineArgs.Count)
+		{
+			ENGINE_CORE_ERROR("Missing value for {}", arg);
+			return false;
+		}
+
+		const char* value = commandLineArgs[++i];
+		if (arg == "--scene")
+			m_SceneHandle = std::stoull(value);
+		else if (arg == "--steps")
+			m_StepsPerSession = std::max<uint32_t>(1, (uint32_t)std::stoul(value));
+		else if (arg == "--sessions")
+			m_SessionCount = std::max<uint32_t>(1, (uint32_t)std::stoul(value));
+		else if (arg == "--instances")
+			m_InstanceCount = std::max<uint32_t>(1, (uint32_t)std::stoul(value));
+		else if (arg == "--ecs-stats")
+			m_ECSStatsPath = value;
+		else if (arg == "--snapshots")
+			m_SnapshotInterval = std::max<uint32_t>(1, (uint32_t)std::stoul(value));
+		else if (arg == "--render-thread")
+			m_UseRenderThread = std::stoul(value) != 0;
+		else if (arg != "--timestep") // read by CreateApplication
+		{
+			ENGINE_CORE_ERROR("Unknown argument {}", arg);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void HeadlessRunner::StartSession()
+{
+	// Snapshots still in flight reference the previous session's assets
+	m_RenderThread.WaitIdle();
+	m_RenderThread.ResetStats();
+	m_ExtractTime = 0.0f;
+	m_ExtractedPrimitives = 0;
+
+	// Reloading copies the scene asset again, so every session starts from the same state
+	if (m_InstanceCount == 1)
+	{
+		Engine::Ref<Engine::Scene> scene = Engine::SceneManager::LoadScene(m_SceneHandle);
+		EnableSnapshots(*scene);
+	}
+	else
+	{
+		StopInstances();
+
+		// Starting runs scripts, so instances start here on the main thread
+		auto sceneAsset = Engine::AssetManager::GetAsset<Engine::Scene>(m_SceneHandle);
+		for (uint32_t i = 0; i < m_InstanceCount; ++i)
+		{
+			Engine::Ref<Engine::Scene> scene = Engine::Scene::Copy(sceneAsset);
+			scene->Handle = m_SceneHandle;
+			EnableSnapshots(*scene);
+			scene->OnRuntimeStart();
+			m_Instances.push_back(scene);
+		}
+	}
+
+	m_Step = 0;
+	m_Running = true;
+	m_SessionTimer.Reset();
+}
+
+void HeadlessRunner::EndSession()
+{
+	float elapsed = m_SessionTimer.Elapsed();
+	uint64_t steps = (uint64_t)m_Step * m_InstanceCount;
+	m_TotalTime += elapsed;
+	m_TotalSteps += steps;
+
+	ENGINE_CORE_INFO("Session {}/{}: {} steps in {:.3f}s, {:.0f} steps/s", m_Session + 1, m_SessionCount, steps, elapsed, steps / elapsed);
+
+	auto scene = m_Instances.empty() ? Engine::SceneManager::GetActiveScene() : m_Instances.front();
+	if (Engine::SceneSnapshotBuffer* snapshots = scene->GetSnapshotBuffer())
+	{
+		const auto& stats = snapshots->GetStats();
+		ENGINE_CORE_INFO("Snapshots: {} ({} keyframes) every {} steps, {:.1f}KB for {:.2f}s of history ({:.1f}KB/s), {:.3f}ms per capture, {:.3f}ms per step",
+			stats.Snapshots, stats.Keyframes, stats.Interval, stats.BytesUsed / 1024.0f, stats.HistoryDuration, stats.BytesPerSecond / 1024.0f,
+			stats.AverageCaptureTime, stats.FrameCost);
+
+		CheckSnapshotRestore(*scene, *snapshots);
+	}
+
+	if (m_UseRenderThread)
+	{
+		m_RenderThread.WaitIdle();
+
+		auto stats = m_RenderThread.GetStats();
+		float frames = (float)std::max<uint64_t>(1, stats.FramesSubmitted);
+		ENGINE_CORE_INFO("Render thread: {} frames, {:.0f} primitives per frame, {:.3f}ms extract, {:.3f}ms main thread wait, {:.3f}ms submit, {:.3f}ms render thread idle per frame",
+			stats.FramesSubmitted, m_ExtractedPrimitives / frames, m_ExtractTime / frames, stats.MainThreadWaitTime / frames,
+			stats.ConsumeTime / frames, stats.RenderThreadWaitTime / frames);
+	}
+}
+
+void HeadlessRunner::ExtractRenderSnapshot()
+{
+	auto scene = m_Instances.empty() ? Engine::SceneManager::GetActiveScene() : m_Instances.front();
+
+	Engine::RenderSnapshot& snapshot = m_RenderThread.BeginFrame();
+
+	Engine::Timer timer;
+	scene->ExtractRenderSnapshot(snapshot);
+	m_ExtractTime += timer.ElapsedMillis();
+	m_ExtractedPrimitives += snapshot.GetPrimitiveCount();
+
+	m_RenderThread.EndFrame();
+}
+
+void HeadlessRunner::EnableSnapshots(Engine::Scene& scene)
+{
+	if (m_SnapshotInterval == 0)
+		return;
+
+	scene.SetSnapshotsEnabled(true);
+	Engine::SceneSnapshotBuffer::Settings settings = scene.GetSnapshotBuffer()->GetSettings();
+	settings.Interval = m_SnapshotInterval;
+	scene.GetSnapshotBuffer()->SetSettings(settings);
+}
+
+void HeadlessRunner::CheckSnapshotRestore(Engine::Scene& scene, Engine::SceneSnapshotBuffer& snapshots)
+{
+	// The session is over, rewinding here doesn't disturb the steps/s measured above
+	snapshots.Capture(scene);
+	uint32_t newest = snapshots.GetSnapshotCount() - 1;
+	if (newest == 0)
+		return;
+
+	Engine::Timer timer;
+	snapshots.Restore(scene, 0);
+	snapshots.Restore(scene, newest);
+	float restoreTime = timer.ElapsedMillis() / 2.0f;
+	bool roundTrip = snapshots.Compare(scene, newest);
+
+	// Continuing after a rewind encodes the next delta against the restored snapshot
+	uint32_t middle = newest / 2;
+	snapshots.Restore(scene, middle);
+	snapshots.Truncate(middle);
+	snapshots.Capture(scene);
+	bool continued = snapshots.Compare(scene, snapshots.GetSnapshotCount() - 1);
+
+	if (roundTrip && continued)
+		ENGINE_CORE_INFO("Snapshot restore check passed: {} snapshots, {:.3f}ms per restore", newest + 1, restoreTime);
+	else
+		ENGINE_CORE_ERROR("Snapshot restore check failed: restoring the newest snapshot {}, recording after a rewind {}",
+			roundTrip ? "matched" : "didn't match", continued ? "matched" : "didn't match");
+}
+
+void HeadlessRunner::StopInstances()
+{
+	for (const auto& scene : m_Instances)
+	{
+		if (scene->IsRunning())
+			scene->OnRuntimeStop();
+	}
+
+	m_Instances.clear();
+}
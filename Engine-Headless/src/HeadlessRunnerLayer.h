@@ -0,0 +1,62 @@
+#pragma once
+#include <Engine.h>
+#include <Engine/Core/Timer.h>
+#include <Engine/Renderer/RenderThread.h>
+
+// Loads a project and runs a scene at a fixed timestep for a number of steps, as fast as possible,
+// then reloads it for the next session. Reports simulation steps per second and closes when done.
+// With more than one instance each session steps independent copies of the scene across the JobSystem,
+// those copies aren't the SceneManager's active scene so scene loads requested by scripts are ignored.
+// Only the component systems (physics smoothing, transform cache, spatial index) of the instances spread over the
+// workers: UI, scripts, the physics step and late scripts touch Mono and all run on the main thread, one at a time.
+// --ecs-stats writes the ECS pool memory and view timings of the (first) scene when the run finishes.
+// --snapshots records scene snapshots every <frames> steps and reports their cost and memory per session. At the end
+// of each session it rewinds to the oldest snapshot and forward to the newest, then rewinds halfway and continues
+// recording from there, checking the scene matches the snapshot exactly each time.
+// --render-thread 1 extracts a render snapshot of the (first) scene every step and submits it to the headless
+// renderer on a render thread while the next step simulates, reporting extraction and handoff cost per session.
+//
+// Usage: Engine-Headless <project> [--scene <handle>] [--steps <count>] [--sessions <count>] [--instances <count>] [--timestep <seconds>] [--ecs-stats <json path>] [--snapshots <frames>] [--render-thread <0|1>]
+class HeadlessRunner : public Engine::Layer
+{
+public:
+	HeadlessRunner()
+		: Engine::Layer("HeadlessRunnerLayer") {}
+	virtual ~HeadlessRunner() = default;
+
+	void OnAttach() override;
+
+	void OnUpdate(Engine::Timestep ts) override;
+
+private:
+	bool ParseCommandLineArgs();
+	void StartSession();
+	void EndSession();
+	void StopInstances();
+	void EnableSnapshots(Engine::Scene& scene);
+	void CheckSnapshotRestore(Engine::Scene& scene, Engine::SceneSnapshotBuffer& snapshots);
+	void ExtractRenderSnapshot();
+
+private:
+	std::filesystem::path m_ProjectPath;
+	Engine::AssetHandle m_SceneHandle = 0;
+	uint32_t m_StepsPerSession = 3600;
+	uint32_t m_SessionCount = 1;
+	uint32_t m_InstanceCount = 1;
+	std::filesystem::path m_ECSStatsPath;
+	uint32_t m_SnapshotInterval = 0;
+	std::vector<Engine::Ref<Engine::Scene>> m_Instances;
+
+	bool m_UseRenderThread = false;
+	Engine::RenderThread m_RenderThread;
+	float m_ExtractTime = 0.0f;
+	uint64_t m_ExtractedPrimitives = 0;
+
+	uint32_t m_Session = 0;
+	uint32_t m_Step = 0;
+	bool m_Running = false;
+
+	Engine::Timer m_SessionTimer;
+	float m_TotalTime = 0.0f;
+	uint64_t m_TotalSteps = 0;
+};
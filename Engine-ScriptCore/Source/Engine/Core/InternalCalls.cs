@@ -179,18 +179,39 @@ namespace Engine.Core
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern ulong Entity_FindEntityByName(string name);
 
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern ulong[] Entity_FindEntitiesByName(string name);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern ulong[] Entity_FindEntitiesWithNamePrefix(string prefix);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern ulong[] Entity_FindEntitiesInRegion(ref Vector2 min, ref Vector2 max);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern ulong[] Entity_FindEntitiesAtPoint(ref Vector2 point);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern ulong[] Entity_FindEntitiesInRadius(ref Vector2 center, float radius);
+
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern ulong Entity_CreateEntity(string name);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern ulong Entity_InstantiatePrefab(ulong prefabID);
 
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern ulong[] Entity_InstantiatePrefabs(ulong prefabID, Vector3[] positions);
+
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern object Entity_GetScriptInstance(ulong entityID);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void Entity_DestroyEntity(ulong entityID);
 
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Entity_Despawn(ulong entityID);
+
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern ulong Entity_GetParent(ulong entityID);
 
@@ -74,7 +74,7 @@ namespace Engine.Scene
 
 		/// <summary>
 		/// Finds first entity in scene that matches the given name.
-		/// Also, this is a slow method that should be avoided, but could be good for testing.
+		/// Names are indexed by the scene, so this is a constant time lookup.
 		/// </summary>
 		/// <param name="name">The name of the Entity to get.</param>
 		/// <returns>The Entity for the given name.</returns>
@@ -84,6 +84,71 @@ namespace Engine.Scene
 			return InternalCalls.Entity_GetScriptInstance(entityID) as Entity;
 		}
 
+		/// <summary>
+		/// Finds every entity in scene with the given name.
+		/// </summary>
+		/// <param name="name">The name of the Entities to get.</param>
+		/// <returns>The Entities for the given name, null if there are none.</returns>
+		public Entity[] FindEntitiesByName(string name)
+		{
+			return ToEntities(InternalCalls.Entity_FindEntitiesByName(name));
+		}
+
+		/// <summary>
+		/// Finds every entity in scene whose name starts with the given prefix.
+		/// </summary>
+		/// <param name="prefix">The start of the names to match.</param>
+		/// <returns>The matching Entities, null if there are none.</returns>
+		public Entity[] FindEntitiesWithNamePrefix(string prefix)
+		{
+			return ToEntities(InternalCalls.Entity_FindEntitiesWithNamePrefix(prefix));
+		}
+
+		/// <summary>
+		/// Finds every entity whose world bounds overlap the region.
+		/// Positions are as of the end of the last frame.
+		/// </summary>
+		/// <param name="min">Bottom left corner of the region.</param>
+		/// <param name="max">Top right corner of the region.</param>
+		/// <returns>The overlapping Entities, null if there are none.</returns>
+		public Entity[] FindEntitiesInRegion(Vector2 min, Vector2 max)
+		{
+			return ToEntities(InternalCalls.Entity_FindEntitiesInRegion(ref min, ref max));
+		}
+
+		/// <summary>
+		/// Finds every entity whose world bounds contain the point.
+		/// </summary>
+		/// <param name="point">The world position to check.</param>
+		/// <returns>The Entities at the point, null if there are none.</returns>
+		public Entity[] FindEntitiesAtPoint(Vector2 point)
+		{
+			return ToEntities(InternalCalls.Entity_FindEntitiesAtPoint(ref point));
+		}
+
+		/// <summary>
+		/// Finds every entity whose world bounds are within radius of center.
+		/// </summary>
+		/// <param name="center">The world position to search around.</param>
+		/// <param name="radius">The search distance.</param>
+		/// <returns>The Entities in range, null if there are none.</returns>
+		public Entity[] FindEntitiesInRadius(Vector2 center, float radius)
+		{
+			return ToEntities(InternalCalls.Entity_FindEntitiesInRadius(ref center, radius));
+		}
+
+		private static Entity[] ToEntities(ulong[] entityIDs)
+		{
+			if (entityIDs == null)
+				return null;
+
+			Entity[] entities = new Entity[entityIDs.Length];
+			for (int i = 0; i < entities.Length; i++)
+				entities[i] = InternalCalls.Entity_GetScriptInstance(entityIDs[i]) as Entity;
+
+			return entities;
+		}
+
 		public Entity CreateEntity(string name = "Entity")
 		{
 			var entityID = InternalCalls.Entity_CreateEntity(name);
@@ -111,6 +176,12 @@ namespace Engine.Scene
 			return InternalCalls.Entity_GetScriptInstance(entityID) as Entity;
 		}
 
+		// One instance per position, reuses despawned instances of the prefab
+		public Entity[] InstantiatePrefab(Prefab prefab, Vector3[] positions)
+		{
+			return ToEntities(InternalCalls.Entity_InstantiatePrefabs(prefab.ID, positions));
+		}
+
 		public T As<T>() where T : Entity, new()
 		{
 			return InternalCalls.Entity_GetScriptInstance(ID) as T;
@@ -121,6 +192,12 @@ namespace Engine.Scene
 			InternalCalls.Entity_DestroyEntity(ID);
 		}
 
+		// Returns a prefab instance to its pool instead of destroying it
+		public void Despawn()
+		{
+			InternalCalls.Entity_Despawn(ID);
+		}
+
 		public Entity Parent
 		{
 			get => InternalCalls.Entity_GetScriptInstance(InternalCalls.Entity_GetParent(ID)) as Entity;
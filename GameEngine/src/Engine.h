@@ -7,6 +7,7 @@
 #include "Engine/Core/Layer.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Buffer.h"
+#include "Engine/Core/JobSystem.h"
 
 #include "Engine/Core/Timestep.h"
 
@@ -29,6 +30,8 @@
 
 #include "Engine/Scene/Scene.h"
 #include "Engine/Scene/Entity.h"
+#include "Engine/Scene/SceneCommandBuffer.h"
+#include "Engine/Scene/SceneSnapshot.h"
 #include "Engine/Scene/ScriptableEntity.h"
 #include "Engine/Scene/Components.h"
 #include "Engine/Scene/SceneManager.h"
@@ -52,6 +55,8 @@
 #include "Engine/Renderer/Renderer.h"
 #include "Engine/Renderer/Renderer2D.h"
 #include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/RenderSnapshot.h"
+#include "Engine/Renderer/RenderThread.h"
 
 #include "Engine/Renderer/Buffer.h"
 #include "Engine/Renderer/Shader.h"
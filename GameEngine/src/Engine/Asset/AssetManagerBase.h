@@ -1,13 +1,15 @@
 #pragma once
 #include "Engine/Asset/Assets.h"
 #include "Engine/Asset/AssetImporter.h"
+#include "Engine/Core/FlatHashMap.h"
 
 namespace Engine
 {
-	using AssetMap = std::unordered_map<AssetHandle, Ref<Asset>>;	
+	using AssetMap = FlatHashMap<AssetHandle, Ref<Asset>>;
 	using AssetRegistry = std::unordered_map<AssetHandle, AssetMetadata>;
 	//using AssetPak = std::unordered_map<AssetHandle, AssetMetadata>; // TODO make proper asset pack (using asset registry atm)
 	using AssetPak = std::unordered_map<AssetHandle, PakAssetEntry>;
+	using AssetNameMap = std::unordered_map<AssetHandle, std::string>;
 
 	class AssetManagerBase
 	{
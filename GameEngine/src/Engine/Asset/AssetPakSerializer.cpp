@@ -10,8 +10,14 @@
 
 namespace Engine
 {
-	void AssetPakSerializer::Serialize(const AssetRegistry& assetRegistry)
+	void AssetPakSerializer::Serialize(const AssetRegistry& assetRegistry, const AssetMap& assets)
 	{
+		auto getAsset = [&](AssetHandle handle)
+		{
+			auto it = assets.find(handle);
+			return it != assets.end() ? it->second : AssetManager::GetAsset<Asset>(handle);
+		};
+
 		// Create header
 		PakHeader header = {};
 		header.PakVersion = PAK_VERSION; // TODO make proper pak version number
@@ -20,6 +26,7 @@ namespace Engine
 
 		std::vector<PakAssetEntry> fileEntries;
 		std::vector<char> dataBuffer = {};
+		std::string nameTable;
 
 		for (const auto& [handle, metadata] : assetRegistry)
 		{
@@ -33,6 +40,7 @@ namespace Engine
 			bool isTextFile = metadata.Type == AssetType::Scene || metadata.Type == AssetType::Prefab;
 			uint32_t fileSize = 0;
 			std::vector<char> fileData;
+			std::string name = metadata.Path.stem().string();
 			if (isTextFile)
 			{
 				switch (metadata.Type)
@@ -40,13 +48,15 @@ namespace Engine
 					case AssetType::Scene:
 					{
 						SceneSerializer serializer = SceneSerializer();
-						fileData = serializer.SerializeForStream(metadata, AssetManager::GetAsset<Scene>(handle));
+						Ref<Scene> scene = As<Scene>(getAsset(handle));
+						fileData = serializer.SerializeForStream(metadata, scene);
+						name = scene->GetSceneName();
 						break;
 					}
 					case AssetType::Prefab:
 					{
 						PrefabSerializer serializer = PrefabSerializer();
-						fileData = serializer.SerializeForStream(metadata, AssetManager::GetAsset<Prefab>(handle));
+						fileData = serializer.SerializeForStream(metadata, getAsset(handle));
 						break;
 					}
 					default:
@@ -95,6 +105,9 @@ namespace Engine
 			pakFileEntry.UncompressedSize = fileSize;
 			pakFileEntry.OffSet = dataBuffer.size();
 			pakFileEntry.Compressed = metadata.Compress;
+			pakFileEntry.NameOffSet = nameTable.size();
+			pakFileEntry.NameSize = name.size();
+			nameTable += name;
 
 			// Compress the data
 			if (pakFileEntry.Compressed)
@@ -116,6 +129,10 @@ namespace Engine
 			header.NumEnteries++;
 		}
 
+		header.NameTableOffSet = dataBuffer.size();
+		header.NameTableSize = nameTable.size();
+		dataBuffer.insert(dataBuffer.end(), nameTable.begin(), nameTable.end());
+
 		std::filesystem::path assetPakPath = Project::GetActiveAssetPakPath();
 		ENGINE_CORE_WARN("Creating Pak File at: {}", assetPakPath);
 		std::ofstream pakFile(assetPakPath, std::ios::binary);
@@ -134,7 +151,7 @@ namespace Engine
 		ENGINE_CORE_WARN("Finished Writing Pak File to: {}", assetPakPath);
 	}
 
-	bool AssetPakSerializer::TryLoadData(AssetPak& assetPak)
+	bool AssetPakSerializer::TryLoadData(AssetPak& assetPak, AssetNameMap& assetNames)
 	{
 		std::filesystem::path assetPakPath = Project::GetActiveAssetPakPath();
 		if (!std::filesystem::exists(assetPakPath))
@@ -184,10 +201,21 @@ namespace Engine
 		}
 		*/
 
+		// One read for all the names
+		std::string nameTable;
+		nameTable.resize(header.NameTableSize);
+		fileStream.seekg(sizeof(header) + header.NumEnteries * sizeof(PakAssetEntry) + header.NameTableOffSet);
+		if (!fileStream.read(nameTable.data(), header.NameTableSize))
+		{
+			ENGINE_CORE_ERROR("Failed to get name table!");
+			return false;
+		}
+
 		for each (const PakAssetEntry entry in fileEntries)
 		{
 			ENGINE_CORE_TRACE("Found AssetHandle {}", entry.Handle);
 			assetPak[entry.Handle] = entry;
+			assetNames[entry.Handle] = nameTable.substr(entry.NameOffSet, entry.NameSize);
 		}
 
 		return true;
@@ -10,7 +10,9 @@ namespace Engine
 	public:
 		AssetPakSerializer() = default;
 
-		void Serialize(const AssetRegistry& assetRegistry);
-		bool TryLoadData(AssetPak& assetPak);
+		// Scenes and prefabs found in assets are written as they are, the rest are imported through the AssetManager.
+		// Lets tools build a pak from generated assets before a project is loaded.
+		void Serialize(const AssetRegistry& assetRegistry, const AssetMap& assets = AssetMap());
+		bool TryLoadData(AssetPak& assetPak, AssetNameMap& assetNames);
 	};
 }
@@ -34,7 +34,7 @@ namespace Engine
 	};
 
 	//TODO Find proper home for pak stuff
-	constexpr char PAK_VERSION = 1;
+	constexpr char PAK_VERSION = 2;
 
 	struct PakHeader
 	{
@@ -44,6 +44,10 @@ namespace Engine
 		//char FolderPath[100];
 		//char PakName[50];
 		uint32_t NumEnteries = 0;
+		// Asset names follow the asset data, so catalogs (e.g. the scene list) are built without importing anything.
+		// Offset from the start of the data, like PakAssetEntry::OffSet.
+		uint32_t NameTableOffSet = 0;
+		uint32_t NameTableSize = 0;
 	};
 
 	struct PakAssetEntry
@@ -55,6 +59,9 @@ namespace Engine
 		uint32_t UncompressedSize = 0;
 		uint32_t CompressedSize = 0;
 		uint32_t OffSet = 0;
+		// Into the name table. Scene name for scenes, file name for everything else.
+		uint32_t NameOffSet = 0;
+		uint32_t NameSize = 0;
 	};
 
 	namespace Utils
@@ -8,7 +8,7 @@ namespace Engine
 	RuntimeAssetManager::RuntimeAssetManager()
 	{
 		AssetPakSerializer assetPakSerializer = AssetPakSerializer();
-		bool didLoad = assetPakSerializer.TryLoadData(m_AssetPak);
+		bool didLoad = assetPakSerializer.TryLoadData(m_AssetPak, m_AssetNames);
 		ENGINE_CORE_ASSERT(didLoad, "Failed to load Asset Pak!");
 
 		m_LoadedAssets = AssetMap();
@@ -45,6 +45,22 @@ namespace Engine
 		return handle.IsValid() && m_LoadedAssets.find(handle) != m_LoadedAssets.end();
 	}
 
+	bool RuntimeAssetManager::TryGetPakEntry(AssetHandle handle, PakAssetEntry& pakEntry) const
+	{
+		auto it = m_AssetPak.find(handle);
+		if (it == m_AssetPak.end())
+			return false;
+
+		pakEntry = it->second;
+		return true;
+	}
+
+	void RuntimeAssetManager::AddLoadedAsset(const Ref<Asset>& asset)
+	{
+		ENGINE_CORE_ASSERT(IsAssetHandleValid(asset->Handle), "Asset isn't in the asset pak!");
+		m_LoadedAssets[asset->Handle] = asset;
+	}
+
 	const AssetMap RuntimeAssetManager::GetAssetsOfType(AssetType type) const
 	{
 		AssetMap assets = {};
@@ -56,4 +72,24 @@ namespace Engine
 
 		return assets;
 	}
+
+	std::vector<AssetHandle> RuntimeAssetManager::GetAssetHandlesOfType(AssetType type) const
+	{
+		std::vector<AssetHandle> handles;
+		for (const auto& [handle, pakEntry] : m_AssetPak)
+		{
+			if (pakEntry.Type == type)
+				handles.push_back(handle);
+		}
+
+		return handles;
+	}
+
+	const std::string& RuntimeAssetManager::GetAssetName(AssetHandle handle) const
+	{
+		static const std::string s_NoName;
+
+		auto it = m_AssetNames.find(handle);
+		return it != m_AssetNames.end() ? it->second : s_NoName;
+	}
 }
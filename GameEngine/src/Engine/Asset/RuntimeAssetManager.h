@@ -14,12 +14,22 @@ namespace Engine
 		bool IsAssetHandleValid(AssetHandle handle) const override;
 		bool IsAssetLoaded(AssetHandle handle) const override;
 
+		// Imports every asset of the type, use GetAssetHandlesOfType and GetAssetName for catalogs
 		const AssetMap GetAssetsOfType(AssetType type) const override;
+		// From the pak table of contents, nothing is imported
+		std::vector<AssetHandle> GetAssetHandlesOfType(AssetType type) const;
+		const std::string& GetAssetName(AssetHandle handle) const;
 
 		const uint32_t GetNumberOfAssetsInAssetPak() const { return m_AssetPak.size(); }
+		// The pak table isn't modified after loading, entries can be looked up from any thread
+		bool TryGetPakEntry(AssetHandle handle, PakAssetEntry& pakEntry) const;
+
+		// For assets imported outside GetAsset, e.g. by background scene loads. Main thread only.
+		void AddLoadedAsset(const Ref<Asset>& asset);
 
 	private:
 		AssetMap m_LoadedAssets;
 		AssetPak m_AssetPak;
+		AssetNameMap m_AssetNames;
 	};
 }
@@ -20,49 +20,34 @@ namespace Engine
 	{
 		ENGINE_PROFILE_FUNCTION();
 
-		std::filesystem::path assetPakPath = Project::GetActiveAssetPakPath();
-		std::ifstream fileStream(assetPakPath, std::ios::binary);
-		if (fileStream.fail())
-		{
-			ENGINE_CORE_ERROR("Failed to open the file!");
-			return false;
-		}
-
-		uint32_t numberOfEntries = Project::GetActive()->GetRuntimeAssetManager()->GetNumberOfAssetsInAssetPak();
-		fileStream.seekg(sizeof(PakHeader) + sizeof(PakAssetEntry) * numberOfEntries + pakEntry.OffSet);
-
-		std::vector<char> fileData;
-		fileData.resize(pakEntry.UncompressedSize); //TODO change when compression
-		fileStream.read(fileData.data(), pakEntry.UncompressedSize);
-
-		Ref<Texture2D> texture = LoadTexture2D({fileData.data(), fileData.size()});
-		texture->Handle = handle;
+		TextureSpecification spec;
+		Buffer pixels = DecodeTexture2DFromPak(pakEntry, spec);
+		if (!pixels)
+			return nullptr;
 
-		return texture;
+		return CreateTexture2D(handle, spec, pixels);
 	}
 
-	Ref<Texture2D> TextureImporter::LoadTexture2D(const std::filesystem::path& filepath)
+	static Buffer DecodeImage(const Buffer buffer, TextureSpecification& spec)
 	{
-		ENGINE_PROFILE_FUNCTION();
-
 		int width, height, channels;
-		stbi_set_flip_vertically_on_load(true);
+		// May run on a worker thread, the global flag isn't safe to set there
+		stbi_set_flip_vertically_on_load_thread(true);
 		Buffer data;
 		{
 			ENGINE_PROFILE_SCOPE("stbi_load - TextureImporter::ImportTexture2D");
-			data.Data = stbi_load(filepath.string().c_str(), &width, &height, &channels, 0);
+			data.Data = stbi_load_from_memory(buffer.Data, buffer.Size, &width, &height, &channels, 0);
 		}
 
 		if (data.Data == nullptr)
 		{
 			ENGINE_CORE_ERROR("Failed to load image!");
-			return nullptr;
+			return data;
 		}
 
 		// TODO: might break later
 		data.Size = width * height * channels;
 
-		TextureSpecification spec;
 		spec.Width = width;
 		spec.Height = height;
 
@@ -76,23 +61,51 @@ namespace Engine
 			break;
 		}
 
-		Ref<Texture2D> texture = Texture2D::Create(spec, data);
-		texture->Handle = AssetHandle();
-		data.Release();
-		return texture;
+		return data;
 	}
 
-	Ref<Texture2D> TextureImporter::LoadTexture2D(const Buffer buffer)
+	Buffer TextureImporter::DecodeTexture2DFromPak(const PakAssetEntry& pakEntry, TextureSpecification& spec)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		std::filesystem::path assetPakPath = Project::GetActiveAssetPakPath();
+		std::ifstream fileStream(assetPakPath, std::ios::binary);
+		if (fileStream.fail())
+		{
+			ENGINE_CORE_ERROR("Failed to open the file!");
+			return Buffer();
+		}
+
+		uint32_t numberOfEntries = Project::GetActive()->GetRuntimeAssetManager()->GetNumberOfAssetsInAssetPak();
+		fileStream.seekg(sizeof(PakHeader) + sizeof(PakAssetEntry) * numberOfEntries + pakEntry.OffSet);
+
+		std::vector<char> fileData;
+		fileData.resize(pakEntry.UncompressedSize); //TODO change when compression
+		fileStream.read(fileData.data(), pakEntry.UncompressedSize);
+
+		return DecodeImage({ fileData.data(), fileData.size() }, spec);
+	}
+
+	Ref<Texture2D> TextureImporter::CreateTexture2D(AssetHandle handle, const TextureSpecification& spec, Buffer pixels)
 	{
 		ENGINE_PROFILE_FUNCTION();
 
+		Ref<Texture2D> texture = Texture2D::Create(spec, pixels);
+		texture->Handle = handle;
+		pixels.Release();
+		return texture;
+	}
+
+	Ref<Texture2D> TextureImporter::LoadTexture2D(const std::filesystem::path& filepath)
+	{
+		ENGINE_PROFILE_FUNCTION();
 
 		int width, height, channels;
 		stbi_set_flip_vertically_on_load(true);
 		Buffer data;
 		{
 			ENGINE_PROFILE_SCOPE("stbi_load - TextureImporter::ImportTexture2D");
-			data.Data = stbi_load_from_memory(buffer.Data, buffer.Size, &width, &height, &channels, 0);
+			data.Data = stbi_load(filepath.string().c_str(), &width, &height, &channels, 0);
 		}
 
 		if (data.Data == nullptr)
@@ -124,6 +137,18 @@ namespace Engine
 		return texture;
 	}
 
+	Ref<Texture2D> TextureImporter::LoadTexture2D(const Buffer buffer)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		TextureSpecification spec;
+		Buffer data = DecodeImage(buffer, spec);
+		if (!data)
+			return nullptr;
+
+		return CreateTexture2D(AssetHandle(), spec, data);
+	}
+
 	//TODO: Remove? Reevaluate asset pipeline
 	void TextureImporter::SaveTexture2D(const AssetMetadata& metadata, const Ref<Asset>& asset)
 	{
@@ -12,6 +12,11 @@ namespace Engine
 		static Ref<Texture2D> LoadTexture2D(const std::filesystem::path& filepath);
 		static Ref<Texture2D> LoadTexture2D(const Buffer buffer);
 
+		// ImportTexture2DFromPak in two halves for background loading. Decoding touches no GL or asset manager
+		// state so any thread may run it, creating the texture (which frees the pixels) has to run on the main thread.
+		static Buffer DecodeTexture2DFromPak(const PakAssetEntry& pakEntry, TextureSpecification& spec);
+		static Ref<Texture2D> CreateTexture2D(AssetHandle handle, const TextureSpecification& spec, Buffer pixels);
+
 		static void SaveTexture2D(const AssetMetadata& metadata, const Ref<Asset>& asset);
 	};
 }
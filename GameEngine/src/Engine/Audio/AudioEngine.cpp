@@ -472,6 +472,26 @@ namespace Engine
 			ma_sound_stop(&sound);
 	}
 
+	void AudioEngine::ReleaseSources(const std::vector<UUID>& entityIDs)
+	{
+		if (!s_AudioEngineData || s_AudioEngineData->AudioSources.empty())
+			return;
+
+		for (UUID entityID : entityIDs)
+		{
+			auto it = s_AudioEngineData->AudioSources.find(entityID);
+			if (it == s_AudioEngineData->AudioSources.end())
+				continue;
+
+			AudioSource& source = it->second;
+			uint32_t instanceCount = std::min(source.SoundInstancesIndex, source.MAX_SOUND_INSTANCES);
+			for (uint32_t i = 0; i < instanceCount; i++)
+				ma_sound_uninit(&source.SoundInstances[i]);
+
+			s_AudioEngineData->AudioSources.erase(it);
+		}
+	}
+
 	void AudioEngine::PausePlayback(bool pause)
 	{
 		if (!s_AudioEngineData)
@@ -39,6 +39,8 @@ namespace Engine
 
 		static void PlaySound(UUID entityID, AssetHandle clip, const SoundParams& params = {});
 		static void StopSound(UUID entityID);
+		// Stops and frees the sound instances of destroyed entities, IDs without any are skipped
+		static void ReleaseSources(const std::vector<UUID>& entityIDs);
 
 		static void PausePlayback(bool pause);
 
@@ -1,5 +1,6 @@
 #include "enginepch.h"
 #include "Engine/Core/Application.h"
+#include "Engine/Core/JobSystem.h"
 
 #include "Engine/Asset/AssetManager.h"
 #include "Engine/Renderer/Renderer.h"
@@ -27,6 +28,15 @@ namespace Engine
 			std::filesystem::current_path(m_Specification.WorkingDirectory);
 		}
 
+		JobSystem::Init();
+
+		if (m_Specification.Headless)
+		{
+			RendererAPI::SetAPI(RendererAPI::API::Headless);
+			Renderer::Init();
+			return;
+		}
+
 		m_Window = Window::Create(WindowProps(m_Specification.Name));
 		m_Window->SetEventCallBack(ENGINE_BIND_EVENT_FN(Application::OnEvent));
 
@@ -43,6 +53,7 @@ namespace Engine
 		AudioEngine::Shutdown();
 		ScriptEngine::Shutdown();
 		Renderer::Shutdown();
+		JobSystem::Shutdown();
 	}
 
 	void Application::PushLayer(Layer* layer)
@@ -101,11 +112,16 @@ namespace Engine
 		{
 			ENGINE_PROFILE_SCOPE("RunLoop");
 		
-			float time = Time::GetTime();
-			Timestep timestep = time - m_LastFrameTime;
-			m_LastFrameTime = time;
+			Timestep timestep = m_Specification.FixedTimestep;
+			if (!m_Specification.Headless)
+			{
+				float time = Time::GetTime();
+				timestep = time - m_LastFrameTime;
+				m_LastFrameTime = time;
+			}
 
 			ExecuteMainThreadQueue();
+			JobSystem::ExecuteMainThreadJobs();
 
 			if (!m_Minimized)
 			{
@@ -117,6 +133,9 @@ namespace Engine
 				}
 			}
 
+			if (m_Specification.Headless)
+				continue;
+
 			m_ImGuiLayer->Begin();
 			{
 				ENGINE_PROFILE_SCOPE("LayerStack OnImGuiRender");
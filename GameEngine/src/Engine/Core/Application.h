@@ -35,6 +35,11 @@ namespace Engine
 		ApplicationCommandLineArgs CommandLineArgs;
 
 		bool Runtime = true;
+
+		// No window, graphics context, ImGui or audio device. Layers are updated with FixedTimestep
+		// as fast as possible instead of real time.
+		bool Headless = false;
+		float FixedTimestep = 1.0f / 60.0f;
 	};
 	
 	class Application
@@ -69,7 +74,7 @@ namespace Engine
 	private:
 		ApplicationSpecification m_Specification;
 		Scope<Window> m_Window;
-		ImGuiLayer* m_ImGuiLayer;
+		ImGuiLayer* m_ImGuiLayer = nullptr;
 		bool m_Running = true;
 		bool m_Minimized = false;
 		LayerStack m_LayerStack;
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+namespace Engine
+{
+	// Open addressing hash map with linear probing. Entries live in one flat array, so lookups touch
+	// neighbouring memory instead of chasing list nodes. Erase shifts the following entries back
+	// rather than leaving tombstones.
+	// Unlike std::unordered_map, inserting or erasing may move entries: don't keep references or
+	// iterators across either.
+	template<typename Key, typename Value, typename Hash = std::hash<Key>>
+	class FlatHashMap
+	{
+	public:
+		using value_type = std::pair<Key, Value>;
+
+		template<bool IsConst>
+		class Iterator
+		{
+		public:
+			using MapType = std::conditional_t<IsConst, const FlatHashMap, FlatHashMap>;
+			using Reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+			using Pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+			Iterator() = default;
+			Iterator(MapType* map, size_t index)
+				: m_Map(map), m_Index(index) { SkipEmpty(); }
+
+			// Allows iterator to const_iterator
+			operator Iterator<true>() const { return { m_Map, m_Index }; }
+
+			Reference operator*() const { return m_Map->m_Slots[m_Index]; }
+			Pointer operator->() const { return &m_Map->m_Slots[m_Index]; }
+
+			Iterator& operator++() { ++m_Index; SkipEmpty(); return *this; }
+
+			bool operator==(const Iterator& other) const { return m_Index == other.m_Index; }
+			bool operator!=(const Iterator& other) const { return m_Index != other.m_Index; }
+		private:
+			void SkipEmpty()
+			{
+				while (m_Index < m_Map->m_Capacity && !m_Map->m_Occupied[m_Index])
+					++m_Index;
+			}
+		private:
+			MapType* m_Map = nullptr;
+			size_t m_Index = 0;
+
+			friend class FlatHashMap;
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		FlatHashMap() = default;
+
+		FlatHashMap(const FlatHashMap& other)
+		{
+			reserve(other.m_Size);
+			for (const auto& [key, value] : other)
+				try_emplace(key, value);
+		}
+
+		FlatHashMap(FlatHashMap&& other) noexcept
+		{
+			Swap(other);
+		}
+
+		~FlatHashMap()
+		{
+			clear();
+			Deallocate();
+		}
+
+		FlatHashMap& operator=(const FlatHashMap& other)
+		{
+			if (this != &other)
+			{
+				FlatHashMap copy(other);
+				Swap(copy);
+			}
+			return *this;
+		}
+
+		FlatHashMap& operator=(FlatHashMap&& other) noexcept
+		{
+			if (this != &other)
+			{
+				clear();
+				Deallocate();
+				Swap(other);
+			}
+			return *this;
+		}
+
+		iterator begin() { return { this, 0 }; }
+		iterator end() { return { this, m_Capacity }; }
+		const_iterator begin() const { return { this, 0 }; }
+		const_iterator end() const { return { this, m_Capacity }; }
+
+		size_t size() const { return m_Size; }
+		bool empty() const { return m_Size == 0; }
+		size_t capacity() const { return m_Capacity; }
+
+		iterator find(const Key& key) { return { this, FindIndex(key) }; }
+		const_iterator find(const Key& key) const { return { this, FindIndex(key) }; }
+		size_t count(const Key& key) const { return FindIndex(key) != m_Capacity ? 1 : 0; }
+		bool contains(const Key& key) const { return FindIndex(key) != m_Capacity; }
+
+		Value& at(const Key& key)
+		{
+			size_t index = FindIndex(key);
+			ENGINE_CORE_ASSERT(index != m_Capacity, "Key not found in FlatHashMap!");
+			return m_Slots[index].second;
+		}
+
+		const Value& at(const Key& key) const
+		{
+			size_t index = FindIndex(key);
+			ENGINE_CORE_ASSERT(index != m_Capacity, "Key not found in FlatHashMap!");
+			return m_Slots[index].second;
+		}
+
+		Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+		template<typename... Args>
+		std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+		{
+			// Only an insert may grow, references to existing values survive a lookup through operator[]
+			size_t index = FindIndex(key);
+			if (index != m_Capacity)
+				return { iterator(this, index), false };
+
+			if ((m_Size + 1) * 8 > m_Capacity * 7)
+				Rehash(m_Capacity == 0 ? 16 : m_Capacity * 2);
+
+			index = Hash{}(key) & (m_Capacity - 1);
+			while (m_Occupied[index])
+				index = (index + 1) & (m_Capacity - 1);
+
+			new (&m_Slots[index]) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			m_Occupied[index] = true;
+			m_Size++;
+			return { iterator(this, index), true };
+		}
+
+		std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+
+		template<typename... Args>
+		std::pair<iterator, bool> emplace(const Key& key, Args&&... args) { return try_emplace(key, std::forward<Args>(args)...); }
+
+		size_t erase(const Key& key)
+		{
+			size_t index = FindIndex(key);
+			if (index == m_Capacity)
+				return 0;
+
+			EraseIndex(index);
+			return 1;
+		}
+
+		void erase(const_iterator it) { EraseIndex(it.m_Index); }
+
+		void clear()
+		{
+			for (size_t i = 0; i < m_Capacity; ++i)
+			{
+				if (m_Occupied[i])
+				{
+					m_Slots[i].~value_type();
+					m_Occupied[i] = false;
+				}
+			}
+			m_Size = 0;
+		}
+
+		void reserve(size_t count)
+		{
+			size_t capacity = m_Capacity == 0 ? 16 : m_Capacity;
+			while (count * 8 > capacity * 7)
+				capacity *= 2;
+
+			if (capacity != m_Capacity)
+				Rehash(capacity);
+		}
+	private:
+		size_t FindIndex(const Key& key) const
+		{
+			if (m_Size == 0)
+				return m_Capacity;
+
+			size_t index = Hash{}(key) & (m_Capacity - 1);
+			while (m_Occupied[index])
+			{
+				if (m_Slots[index].first == key)
+					return index;
+
+				index = (index + 1) & (m_Capacity - 1);
+			}
+
+			return m_Capacity;
+		}
+
+		void EraseIndex(size_t hole)
+		{
+			m_Slots[hole].~value_type();
+			m_Occupied[hole] = false;
+			m_Size--;
+
+			// Pull back later entries of the probe run that can legally sit in the hole
+			size_t mask = m_Capacity - 1;
+			for (size_t index = (hole + 1) & mask; m_Occupied[index]; index = (index + 1) & mask)
+			{
+				size_t home = Hash{}(m_Slots[index].first) & mask;
+				// Distance from home is measured cyclically, an entry stays if its home lies between the hole and itself
+				if (((index - home) & mask) < ((index - hole) & mask))
+					continue;
+
+				new (&m_Slots[hole]) value_type(std::move(m_Slots[index]));
+				m_Occupied[hole] = true;
+				m_Slots[index].~value_type();
+				m_Occupied[index] = false;
+				hole = index;
+			}
+		}
+
+		void Rehash(size_t capacity)
+		{
+			value_type* slots = m_Slots;
+			Scope<bool[]> occupied = std::move(m_Occupied);
+			size_t oldCapacity = m_Capacity;
+
+			m_Slots = std::allocator<value_type>().allocate(capacity);
+			m_Occupied = CreateScope<bool[]>(capacity);
+			m_Capacity = capacity;
+
+			size_t mask = m_Capacity - 1;
+			for (size_t i = 0; i < oldCapacity; ++i)
+			{
+				if (!occupied[i])
+					continue;
+
+				size_t index = Hash{}(slots[i].first) & mask;
+				while (m_Occupied[index])
+					index = (index + 1) & mask;
+
+				new (&m_Slots[index]) value_type(std::move(slots[i]));
+				m_Occupied[index] = true;
+				slots[i].~value_type();
+			}
+
+			if (slots)
+				std::allocator<value_type>().deallocate(slots, oldCapacity);
+		}
+
+		void Deallocate()
+		{
+			if (m_Slots)
+				std::allocator<value_type>().deallocate(m_Slots, m_Capacity);
+
+			m_Slots = nullptr;
+			m_Occupied.reset();
+			m_Capacity = 0;
+		}
+
+		void Swap(FlatHashMap& other)
+		{
+			std::swap(m_Slots, other.m_Slots);
+			std::swap(m_Occupied, other.m_Occupied);
+			std::swap(m_Size, other.m_Size);
+			std::swap(m_Capacity, other.m_Capacity);
+		}
+	private:
+		value_type* m_Slots = nullptr;
+		Scope<bool[]> m_Occupied;
+		size_t m_Size = 0;
+		size_t m_Capacity = 0; // always zero or a power of two
+	};
+}
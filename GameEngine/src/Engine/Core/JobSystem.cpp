@@ -0,0 +1,346 @@
+#include "enginepch.h"
+#include "Engine/Core/JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace Engine
+{
+	// Owner pushes and pops at the back, thieves take from the front
+	struct WorkQueue
+	{
+		std::mutex Mutex;
+		std::deque<Job> Jobs;
+	};
+
+	struct JobSystemData
+	{
+		std::vector<std::thread> Workers;
+		// Index 0 belongs to the main thread, the rest to workers
+		std::vector<Scope<WorkQueue>> Queues;
+		std::atomic<bool> Running = false;
+		std::atomic<uint32_t> NextQueue = 0;
+		std::thread::id MainThreadID;
+
+		std::mutex MainThreadMutex;
+		std::vector<Job> MainThreadJobs;
+
+		std::atomic<int32_t> PendingJobs = 0;
+		std::mutex WakeMutex;
+		std::condition_variable WakeCondition;
+
+		std::atomic<uint64_t> JobsKicked = 0;
+		std::atomic<uint64_t> JobsExecuted = 0;
+		std::atomic<uint64_t> JobsStolen = 0;
+		std::atomic<uint64_t> MainThreadJobsExecuted = 0;
+		std::atomic<uint64_t> ParallelForCalls = 0;
+	};
+
+	static JobSystemData s_JobSystemData;
+	static thread_local int32_t s_QueueIndex = -1;
+
+	void JobSystem::Init(uint32_t workerCount)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		ENGINE_CORE_ASSERT(!s_JobSystemData.Running, "JobSystem already initialized!");
+
+		if (workerCount == 0)
+			workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+		s_JobSystemData.MainThreadID = std::this_thread::get_id();
+		s_QueueIndex = 0;
+
+		s_JobSystemData.Queues.clear();
+		for (uint32_t i = 0; i < workerCount + 1; ++i)
+			s_JobSystemData.Queues.emplace_back(CreateScope<WorkQueue>());
+
+		s_JobSystemData.Running = true;
+		for (uint32_t i = 0; i < workerCount; ++i)
+			s_JobSystemData.Workers.emplace_back(&JobSystem::WorkerThread, (int32_t)i + 1);
+
+		ENGINE_CORE_INFO("JobSystem started with {0} workers", workerCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (!s_JobSystemData.Running)
+			return;
+
+		{
+			std::scoped_lock<std::mutex> lock(s_JobSystemData.WakeMutex);
+			s_JobSystemData.Running = false;
+		}
+		s_JobSystemData.WakeCondition.notify_all();
+
+		for (auto& worker : s_JobSystemData.Workers)
+			worker.join();
+		s_JobSystemData.Workers.clear();
+
+		// Anything left over still has to run so no counter is left waiting
+		for (auto& queue : s_JobSystemData.Queues)
+		{
+			while (!queue->Jobs.empty())
+			{
+				Job job = std::move(queue->Jobs.front());
+				queue->Jobs.pop_front();
+				RunJob(job);
+			}
+		}
+		ExecuteMainThreadJobs();
+
+		s_JobSystemData.Queues.clear();
+		s_JobSystemData.PendingJobs = 0;
+	}
+
+	void JobSystem::Kick(const std::function<void()>& function, JobCounter* counter, JobAffinity affinity)
+	{
+		if (counter)
+			counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+
+		s_JobSystemData.JobsKicked.fetch_add(1, std::memory_order_relaxed);
+		Push({ function, counter, affinity });
+	}
+
+	void JobSystem::KickAfter(JobCounter& dependency, const std::function<void()>& function, JobCounter* counter, JobAffinity affinity)
+	{
+		if (counter)
+			counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+
+		s_JobSystemData.JobsKicked.fetch_add(1, std::memory_order_relaxed);
+
+		{
+			std::scoped_lock<std::mutex> lock(dependency.m_ContinuationMutex);
+			if (dependency.m_Count.load(std::memory_order_acquire) != 0)
+			{
+				dependency.m_Continuations.push_back({ function, counter, affinity });
+				return;
+			}
+		}
+
+		Push({ function, counter, affinity });
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		bool mainThread = IsMainThread();
+		while (!counter.IsDone())
+		{
+			if (mainThread)
+				ExecuteMainThreadJobs();
+
+			if (!TryRunJob(s_QueueIndex))
+				std::this_thread::yield();
+		}
+
+		// The finishing job may still be releasing the lock, the counter is usually on the caller's stack
+		std::scoped_lock<std::mutex> lock(counter.m_ContinuationMutex);
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& function)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (count == 0)
+			return;
+
+		grainSize = std::max(grainSize, 1u);
+		if (!s_JobSystemData.Running || count <= grainSize)
+		{
+			function(0, count);
+			return;
+		}
+
+		s_JobSystemData.ParallelForCalls.fetch_add(1, std::memory_order_relaxed);
+
+		// The calling thread takes the first range itself
+		JobCounter counter;
+		for (uint32_t begin = grainSize; begin < count; begin += grainSize)
+		{
+			uint32_t end = std::min(begin + grainSize, count);
+			Kick([&function, begin, end]() { function(begin, end); }, &counter);
+		}
+
+		function(0, grainSize);
+		Wait(counter);
+	}
+
+	void JobSystem::ExecuteMainThreadJobs()
+	{
+		ENGINE_CORE_ASSERT(IsMainThread(), "Main thread jobs can only be executed on the main thread!");
+
+		std::vector<Job> jobs;
+		{
+			std::scoped_lock<std::mutex> lock(s_JobSystemData.MainThreadMutex);
+			if (s_JobSystemData.MainThreadJobs.empty())
+				return;
+
+			std::swap(jobs, s_JobSystemData.MainThreadJobs);
+		}
+
+		ENGINE_PROFILE_SCOPE("JobSystem::ExecuteMainThreadJobs");
+
+		for (Job& job : jobs)
+		{
+			RunJob(job);
+			s_JobSystemData.MainThreadJobsExecuted.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	bool JobSystem::IsMainThread()
+	{
+		return std::this_thread::get_id() == s_JobSystemData.MainThreadID;
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return (uint32_t)s_JobSystemData.Workers.size();
+	}
+
+	JobSystem::Statistics JobSystem::GetStats()
+	{
+		Statistics stats;
+		stats.JobsKicked = s_JobSystemData.JobsKicked.load(std::memory_order_relaxed);
+		stats.JobsExecuted = s_JobSystemData.JobsExecuted.load(std::memory_order_relaxed);
+		stats.JobsStolen = s_JobSystemData.JobsStolen.load(std::memory_order_relaxed);
+		stats.MainThreadJobsExecuted = s_JobSystemData.MainThreadJobsExecuted.load(std::memory_order_relaxed);
+		stats.ParallelForCalls = s_JobSystemData.ParallelForCalls.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	void JobSystem::ResetStats()
+	{
+		s_JobSystemData.JobsKicked = 0;
+		s_JobSystemData.JobsExecuted = 0;
+		s_JobSystemData.JobsStolen = 0;
+		s_JobSystemData.MainThreadJobsExecuted = 0;
+		s_JobSystemData.ParallelForCalls = 0;
+	}
+
+	void JobSystem::Push(Job job)
+	{
+		// Without workers everything runs inline, so tools and tests work without Init
+		if (!s_JobSystemData.Running)
+		{
+			RunJob(job);
+			return;
+		}
+
+		if (job.Affinity == JobAffinity::MainThread)
+		{
+			std::scoped_lock<std::mutex> lock(s_JobSystemData.MainThreadMutex);
+			s_JobSystemData.MainThreadJobs.emplace_back(std::move(job));
+			return;
+		}
+
+		// Threads the system doesn't own spread their jobs over the workers
+		uint32_t queueCount = (uint32_t)s_JobSystemData.Queues.size();
+		uint32_t queueIndex = s_QueueIndex >= 0 ? (uint32_t)s_QueueIndex : 1 + s_JobSystemData.NextQueue.fetch_add(1, std::memory_order_relaxed) % (queueCount - 1);
+
+		s_JobSystemData.PendingJobs.fetch_add(1, std::memory_order_release);
+		{
+			WorkQueue& queue = *s_JobSystemData.Queues[queueIndex];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			queue.Jobs.emplace_back(std::move(job));
+		}
+
+		{
+			std::scoped_lock<std::mutex> lock(s_JobSystemData.WakeMutex);
+		}
+		s_JobSystemData.WakeCondition.notify_one();
+	}
+
+	bool JobSystem::TryRunJob(int32_t queueIndex)
+	{
+		Job job;
+		bool found = false;
+
+		if (queueIndex >= 0)
+		{
+			WorkQueue& queue = *s_JobSystemData.Queues[queueIndex];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			if (!queue.Jobs.empty())
+			{
+				job = std::move(queue.Jobs.back());
+				queue.Jobs.pop_back();
+				found = true;
+			}
+		}
+
+		if (!found)
+		{
+			uint32_t queueCount = (uint32_t)s_JobSystemData.Queues.size();
+			uint32_t start = queueIndex >= 0 ? (uint32_t)queueIndex : 0;
+			for (uint32_t i = 1; i <= queueCount && !found; ++i)
+			{
+				uint32_t victim = (start + i) % queueCount;
+				if ((int32_t)victim == queueIndex)
+					continue;
+
+				WorkQueue& queue = *s_JobSystemData.Queues[victim];
+				std::scoped_lock<std::mutex> lock(queue.Mutex);
+				if (!queue.Jobs.empty())
+				{
+					job = std::move(queue.Jobs.front());
+					queue.Jobs.pop_front();
+					found = true;
+					s_JobSystemData.JobsStolen.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		if (!found)
+			return false;
+
+		s_JobSystemData.PendingJobs.fetch_sub(1, std::memory_order_acquire);
+		RunJob(job);
+		return true;
+	}
+
+	void JobSystem::RunJob(Job& job)
+	{
+		{
+			ENGINE_PROFILE_SCOPE("JobSystem::RunJob");
+			job.Function();
+		}
+
+		s_JobSystemData.JobsExecuted.fetch_add(1, std::memory_order_relaxed);
+		FinishJob(job.Counter);
+	}
+
+	void JobSystem::FinishJob(JobCounter* counter)
+	{
+		if (!counter)
+			return;
+
+		// Decrement under the lock so KickAfter can't append to a counter that already finished
+		std::vector<Job> continuations;
+		{
+			std::scoped_lock<std::mutex> lock(counter->m_ContinuationMutex);
+			if (counter->m_Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				std::swap(continuations, counter->m_Continuations);
+		}
+
+		for (Job& continuation : continuations)
+			Push(std::move(continuation));
+	}
+
+	void JobSystem::WorkerThread(int32_t queueIndex)
+	{
+		s_QueueIndex = queueIndex;
+
+		while (s_JobSystemData.Running)
+		{
+			if (TryRunJob(queueIndex))
+				continue;
+
+			std::unique_lock<std::mutex> lock(s_JobSystemData.WakeMutex);
+			s_JobSystemData.WakeCondition.wait(lock, []() { return s_JobSystemData.PendingJobs.load(std::memory_order_acquire) > 0 || !s_JobSystemData.Running; });
+		}
+	}
+}
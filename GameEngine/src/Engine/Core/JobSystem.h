@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+namespace Engine
+{
+	enum class JobAffinity
+	{
+		// Any worker (or a waiting thread) may run the job
+		Any = 0,
+		// Only the thread that owns the GL context and Mono domain may run the job
+		MainThread
+	};
+
+	class JobCounter;
+
+	struct Job
+	{
+		std::function<void()> Function;
+		JobCounter* Counter = nullptr;
+		JobAffinity Affinity = JobAffinity::Any;
+	};
+
+	// Tracks a group of jobs. Jobs kicked with KickAfter start once the counter reaches zero.
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool IsDone() const { return m_Count.load(std::memory_order_acquire) == 0; }
+		uint32_t GetCount() const { return m_Count.load(std::memory_order_acquire); }
+	private:
+		std::atomic<uint32_t> m_Count = 0;
+
+		std::mutex m_ContinuationMutex;
+		std::vector<Job> m_Continuations;
+
+		friend class JobSystem;
+	};
+
+	class JobSystem
+	{
+	public:
+		// workerCount of 0 uses one worker per hardware thread, minus the main thread
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		static void Kick(const std::function<void()>& function, JobCounter* counter = nullptr, JobAffinity affinity = JobAffinity::Any);
+		// Runs function once dependency reaches zero, counter is incremented immediately
+		static void KickAfter(JobCounter& dependency, const std::function<void()>& function, JobCounter* counter = nullptr, JobAffinity affinity = JobAffinity::Any);
+
+		// Blocks until counter reaches zero, running other jobs while waiting
+		static void Wait(JobCounter& counter);
+
+		// Splits [0, count) into ranges of at most grainSize and waits for all of them
+		static void ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& function);
+
+		// Runs jobs kicked with JobAffinity::MainThread, called once per frame by Application
+		static void ExecuteMainThreadJobs();
+
+		static bool IsMainThread();
+		static uint32_t GetWorkerCount();
+
+		struct Statistics
+		{
+			uint64_t JobsKicked = 0;
+			uint64_t JobsExecuted = 0;
+			uint64_t JobsStolen = 0;
+			uint64_t MainThreadJobsExecuted = 0;
+			uint64_t ParallelForCalls = 0;
+		};
+
+		static Statistics GetStats();
+		static void ResetStats();
+	private:
+		static void Push(Job job);
+		static bool TryRunJob(int32_t queueIndex);
+		static void RunJob(Job& job);
+		static void FinishJob(JobCounter* counter);
+		static void WorkerThread(int32_t queueIndex);
+	};
+}
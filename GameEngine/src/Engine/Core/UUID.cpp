@@ -1,19 +1,62 @@
 #include "enginepch.h"
 #include "UUID.h"
 
+#include <atomic>
 #include <random>
 
 namespace Engine
 {
-	static std::random_device s_RandomDevice;
-	static std::mt19937_64 s_Engine(s_RandomDevice());
-	static std::uniform_int_distribution<uint64_t> s_UniformDistribution;
+	// IDs are a random per-process key plus a counter, run through the splitmix64 finalizer.
+	// The finalizer is a bijection, so IDs from one process never collide, and threads claim blocks
+	// of the counter so generating only touches the shared atomic once per block.
+	static constexpr uint64_t s_BlockSize = 1024;
+
+	static uint64_t GenerateProcessKey()
+	{
+		std::random_device randomDevice;
+		std::uniform_int_distribution<uint64_t> distribution;
+		return distribution(randomDevice);
+	}
+
+	static std::atomic<uint64_t> s_NextBlock{ 0 };
+
+	struct CounterBlock
+	{
+		uint64_t Next = 0;
+		uint64_t End = 0;
+	};
+
+	static thread_local CounterBlock s_CounterBlock;
+
+	static uint64_t Mix(uint64_t counter)
+	{
+		// Function local so IDs made during static initialization still get a key
+		static const uint64_t s_ProcessKey = GenerateProcessKey();
+
+		uint64_t value = s_ProcessKey + counter * 0x9e3779b97f4a7c15ull;
+		value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+		value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+		return value ^ (value >> 31);
+	}
+
+	static uint64_t NextCounter()
+	{
+		CounterBlock& block = s_CounterBlock;
+		if (block.Next == block.End)
+		{
+			block.Next = s_NextBlock.fetch_add(s_BlockSize, std::memory_order_relaxed);
+			block.End = block.Next + s_BlockSize;
+		}
+
+		return block.Next++;
+	}
 
 	UUID::UUID()
-		: m_UUID(s_UniformDistribution(s_Engine))
+		: m_UUID(Mix(NextCounter()))
 	{
+		// One counter value maps to the invalid ID
 		while (m_UUID == INVALID())
-			m_UUID = s_UniformDistribution(s_Engine);
+			m_UUID = Mix(NextCounter());
 	}
 
 	UUID::UUID(uint64_t uuid)
@@ -21,4 +64,23 @@ namespace Engine
 	{
 
 	}
+
+	void UUID::Generate(std::vector<UUID>& uuids, size_t count)
+	{
+		uuids.reserve(uuids.size() + count);
+
+		// Big batches claim their own range, leaving the thread's block for single IDs
+		uint64_t counter = count >= s_BlockSize ? s_NextBlock.fetch_add(count, std::memory_order_relaxed) : 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			uint64_t uuid = Mix(count >= s_BlockSize ? counter++ : NextCounter());
+			if (uuid == INVALID())
+			{
+				uuids.emplace_back();
+				continue;
+			}
+
+			uuids.emplace_back(uuid);
+		}
+	}
 }
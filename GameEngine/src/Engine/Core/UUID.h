@@ -2,6 +2,7 @@
 
 namespace Engine
 {
+	// Generating is thread safe and lock free
 	class UUID
 	{
 	public:
@@ -9,6 +10,9 @@ namespace Engine
 		UUID(uint64_t uuid);
 		UUID(const UUID&) = default;
 
+		// Appends count new IDs, cheaper than constructing them one at a time for batched spawns
+		static void Generate(std::vector<UUID>& uuids, size_t count);
+
 		operator uint64_t() const { return m_UUID; }
 
 		inline static const UUID INVALID() { return NULL; }
@@ -26,9 +30,13 @@ namespace std
 	template<>
 	struct hash<Engine::UUID>
 	{
+		// splitmix64 finalizer, the raw value leaves hand made or sequential ids clustered in power of two tables
 		std::size_t operator()(const Engine::UUID& uuid) const
 		{
-			return (uint64_t)uuid;
+			uint64_t hash = (uint64_t)uuid;
+			hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+			hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+			return hash ^ (hash >> 31);
 		}
 	};
 }
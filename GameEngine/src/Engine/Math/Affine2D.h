@@ -0,0 +1,132 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+	#define ENGINE_AFFINE2D_SSE
+	#include <emmintrin.h>
+#endif
+
+namespace Engine
+{
+	// 2D affine transform, maps p to X * p.x + Y * p.y + Translation.
+	// The columns of the 2x2 part sit in one 16 byte lane so compose, invert and apply are a few SSE ops,
+	// and the whole transform is half the size of a glm::mat4.
+	// Depth is only carried along for draw order: it adds through composition and is never scaled.
+	struct alignas(16) Affine2D
+	{
+		glm::vec2 X{ 1.0f, 0.0f };
+		glm::vec2 Y{ 0.0f, 1.0f };
+		glm::vec2 Translation{ 0.0f };
+		float Depth = 0.0f;
+
+		Affine2D() = default;
+		Affine2D(const glm::vec2& x, const glm::vec2& y, const glm::vec2& translation, float depth = 0.0f)
+			: X(x), Y(y), Translation(translation), Depth(depth) {}
+
+		// translate * rotate * scale, same as Math::GenRectTransform
+		Affine2D(const glm::vec3& position, float rotation, const glm::vec2& scale)
+			: Translation(position), Depth(position.z)
+		{
+			float cosZ = glm::cos(rotation);
+			float sinZ = glm::sin(rotation);
+			X = { cosZ * scale.x, sinZ * scale.x };
+			Y = { -sinZ * scale.y, cosZ * scale.y };
+		}
+
+		// Drops anything outside the XY plane
+		static Affine2D FromMat4(const glm::mat4& transform)
+		{
+			return { glm::vec2(transform[0]), glm::vec2(transform[1]), glm::vec2(transform[3]), transform[3].z };
+		}
+
+		glm::mat4 ToMat4() const
+		{
+			return glm::mat4(
+				glm::vec4(X, 0.0f, 0.0f),
+				glm::vec4(Y, 0.0f, 0.0f),
+				glm::vec4(0.0f, 0.0f, 1.0f, 0.0f),
+				glm::vec4(Translation, Depth, 1.0f));
+		}
+
+		Affine2D operator*(const Affine2D& other) const
+		{
+			Affine2D result;
+#ifdef ENGINE_AFFINE2D_SSE
+			__m128 linear = _mm_load_ps(&X.x);
+			__m128 xx = _mm_movelh_ps(linear, linear); // X X
+			__m128 yy = _mm_movehl_ps(linear, linear); // Y Y
+
+			__m128 otherLinear = _mm_load_ps(&other.X.x);
+			__m128 resultLinear = _mm_add_ps(
+				_mm_mul_ps(xx, _mm_shuffle_ps(otherLinear, otherLinear, _MM_SHUFFLE(2, 2, 0, 0))),
+				_mm_mul_ps(yy, _mm_shuffle_ps(otherLinear, otherLinear, _MM_SHUFFLE(3, 3, 1, 1))));
+			_mm_store_ps(&result.X.x, resultLinear);
+
+			__m128 otherTranslation = _mm_load_ps(&other.Translation.x);
+			__m128 resultTranslation = _mm_add_ps(_mm_load_ps(&Translation.x), _mm_add_ps(
+				_mm_mul_ps(xx, _mm_shuffle_ps(otherTranslation, otherTranslation, _MM_SHUFFLE(0, 0, 0, 0))),
+				_mm_mul_ps(yy, _mm_shuffle_ps(otherTranslation, otherTranslation, _MM_SHUFFLE(1, 1, 1, 1)))));
+			_mm_storel_pi((__m64*)&result.Translation.x, resultTranslation);
+#else
+			result.X = X * other.X.x + Y * other.X.y;
+			result.Y = X * other.Y.x + Y * other.Y.y;
+			result.Translation = X * other.Translation.x + Y * other.Translation.y + Translation;
+#endif
+			result.Depth = Depth + other.Depth;
+			return result;
+		}
+
+		Affine2D& operator*=(const Affine2D& other) { return *this = *this * other; }
+
+		float Determinant() const { return X.x * Y.y - Y.x * X.y; }
+
+		// Singular transforms (zero scale) invert to garbage, check Determinant first if that can happen
+		Affine2D Inverse() const
+		{
+			Affine2D result;
+			float invDet = 1.0f / Determinant();
+#ifdef ENGINE_AFFINE2D_SSE
+			// [ a b c d ] -> [ d -b -c a ] / det
+			__m128 linear = _mm_load_ps(&X.x);
+			__m128 adjugate = _mm_mul_ps(_mm_shuffle_ps(linear, linear, _MM_SHUFFLE(0, 2, 1, 3)), _mm_setr_ps(invDet, -invDet, -invDet, invDet));
+			_mm_store_ps(&result.X.x, adjugate);
+
+			__m128 translation = _mm_load_ps(&Translation.x);
+			__m128 resultTranslation = _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(
+				_mm_mul_ps(_mm_movelh_ps(adjugate, adjugate), _mm_shuffle_ps(translation, translation, _MM_SHUFFLE(0, 0, 0, 0))),
+				_mm_mul_ps(_mm_movehl_ps(adjugate, adjugate), _mm_shuffle_ps(translation, translation, _MM_SHUFFLE(1, 1, 1, 1)))));
+			_mm_storel_pi((__m64*)&result.Translation.x, resultTranslation);
+#else
+			result.X = glm::vec2(Y.y, -X.y) * invDet;
+			result.Y = glm::vec2(-Y.x, X.x) * invDet;
+			result.Translation = -(result.X * Translation.x + result.Y * Translation.y);
+#endif
+			result.Depth = -Depth;
+			return result;
+		}
+
+		glm::vec2 Apply(const glm::vec2& point) const
+		{
+#ifdef ENGINE_AFFINE2D_SSE
+			__m128 products = _mm_mul_ps(_mm_load_ps(&X.x), _mm_setr_ps(point.x, point.x, point.y, point.y));
+			__m128 result = _mm_add_ps(_mm_add_ps(products, _mm_movehl_ps(products, products)), _mm_load_ps(&Translation.x));
+
+			glm::vec2 applied;
+			_mm_storel_pi((__m64*)&applied.x, result);
+			return applied;
+#else
+			return X * point.x + Y * point.y + Translation;
+#endif
+		}
+
+		// Point in the XY plane at this transform's depth
+		glm::vec3 Apply3D(const glm::vec2& point) const { return glm::vec3(Apply(point), Depth); }
+
+		// Direction, ignores translation
+		glm::vec2 ApplyVector(const glm::vec2& vector) const { return X * vector.x + Y * vector.y; }
+
+		float GetRotation() const { return glm::atan(X.y, X.x); }
+		glm::vec2 GetScale() const { return { glm::length(X), glm::length(Y) }; }
+	};
+}
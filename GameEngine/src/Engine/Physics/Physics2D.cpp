@@ -1,37 +1,14 @@
 #include "enginepch.h"
 #include "Engine/Physics/Physics2D.h"
 #include "Engine/Scripting/ScriptEngine.h"
-#include "Engine/Scene/SceneManager.h"
 
 #include <box2d/b2_fixture.h>
 #include <box2d/b2_polygon_shape.h>
 #include "box2d/b2_circle_shape.h"
+#include <box2d/b2_edge_shape.h>
 
 namespace Engine
 {
-	Physics2DContactListener g_ContactListener;
-
-	struct PhysicsWorldSettings
-	{
-		const float PHYSICS_TIMESTEP = 1.0f / 60.0f;
-		const uint32_t VELOCITY_INTERACTIONS = 20;
-		const uint32_t POSITION_INTERACTIONS = 16;
-	};
-
-	struct Physics2DEngineData
-	{
-		b2World* PhysicsWorld = nullptr;
-		float Accumulator = 0.0f;
-		float AccumulatorRatio = 0.0f;
-		PhysicsWorldSettings Settings;
-
-		std::vector<b2Body*> QueuedBodiesToDestroy = std::vector<b2Body*>();
-		std::unordered_map<b2Body*, glm::vec2> QueuedBodiesToPosition = std::unordered_map<b2Body*, glm::vec2>();
-		std::unordered_map<b2Body*, float> QueuedBodiesToRotate = std::unordered_map<b2Body*, float>();
-	};
-
-	static Physics2DEngineData* s_physics2DEngineData = nullptr;
-
 	static b2FixtureDef CreateFixtureDef(const b2Shape& shape, const float density, const float friction, const float restitution, const float restitutionThreshold, const bool sensor)
 	{
 		b2FixtureDef fixtureDef;
@@ -44,60 +21,75 @@ namespace Engine
 		return fixtureDef;
 	}
 
-	static void DestroyQueuedBodiesToDestroy()
+	static Physics2DContext& GetContext(Scene* scene)
+	{
+		Physics2DContext* context = scene->GetPhysics2DContext();
+		ENGINE_CORE_ASSERT(context, "Scene physics haven't been started!");
+		return *context;
+	}
+
+	static void DestroyOrQueueBody(Physics2DContext& context, b2Body* body)
+	{
+		if (context.PhysicsWorld->IsLocked())
+			context.QueuedBodiesToDestroy.emplace_back(body);
+		else
+			context.PhysicsWorld->DestroyBody(body);
+	}
+
+	static void DestroyQueuedBodiesToDestroy(Physics2DContext& context)
 	{
-		if (s_physics2DEngineData->QueuedBodiesToDestroy.empty())
+		if (context.QueuedBodiesToDestroy.empty())
 			return;
 
-		for (b2Body* body : s_physics2DEngineData->QueuedBodiesToDestroy)
+		for (b2Body* body : context.QueuedBodiesToDestroy)
 		{
 			if (body)
-				s_physics2DEngineData->PhysicsWorld->DestroyBody(body);
+				context.PhysicsWorld->DestroyBody(body);
 		}
 
-		s_physics2DEngineData->QueuedBodiesToDestroy.clear();
+		context.QueuedBodiesToDestroy.clear();
 	}
 
-	static void SetPositionQueuedBodiesToPosition()
+	static void SetPositionQueuedBodiesToPosition(Physics2DContext& context)
 	{
-		if (s_physics2DEngineData->QueuedBodiesToPosition.empty())
+		if (context.QueuedBodiesToPosition.empty())
 			return;
 
-		for (const auto& [body, position] : s_physics2DEngineData->QueuedBodiesToPosition)
+		for (const auto& [body, position] : context.QueuedBodiesToPosition)
 		{
 			if (body)
 				body->SetTransform({ position.x, position.y }, body->GetAngle());
 		}
 
-		s_physics2DEngineData->QueuedBodiesToPosition.clear();
+		context.QueuedBodiesToPosition.clear();
 	}
 
-	static void SetRotationQueuedBodiesToRotate()
+	static void SetRotationQueuedBodiesToRotate(Physics2DContext& context)
 	{
-		if (s_physics2DEngineData->QueuedBodiesToRotate.empty())
+		if (context.QueuedBodiesToRotate.empty())
 			return;
 
-		for (const auto& [body, angle] : s_physics2DEngineData->QueuedBodiesToRotate)
+		for (const auto& [body, angle] : context.QueuedBodiesToRotate)
 		{
 			if (body)
 				body->SetTransform(body->GetPosition(), angle);
 		}
 
-		s_physics2DEngineData->QueuedBodiesToRotate.clear();
+		context.QueuedBodiesToRotate.clear();
 	}
 
-	void Physics2DEngine::OnPhysicsStart()
+	void Physics2DEngine::OnPhysicsStart(Scene* scene)
 	{
-		s_physics2DEngineData = new Physics2DEngineData();
+		Physics2DContext& context = GetContext(scene);
 
-		s_physics2DEngineData->PhysicsWorld = new b2World({ 0.0f, -9.8f });
-		s_physics2DEngineData->PhysicsWorld->SetAllowSleeping(true);
-		s_physics2DEngineData->PhysicsWorld->SetAutoClearForces(false);
+		context.PhysicsWorld = new b2World({ 0.0f, -9.8f });
+		context.PhysicsWorld->SetAllowSleeping(true);
+		context.PhysicsWorld->SetAutoClearForces(false);
 
-		auto view = SceneManager::GetActiveScene()->GetAllEntitiesWith<Rigidbody2DComponent>();
+		auto view = scene->GetAllEntitiesWith<Rigidbody2DComponent>();
 		for (auto e : view)
 		{
-			Entity entity = { e, SceneManager::GetActiveScene().get() };
+			Entity entity = { e, scene };
 			auto& transform = entity.GetComponent<TransformComponent>();
 			auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
 
@@ -116,101 +108,123 @@ namespace Engine
 			}
 		}
 
-		if (SceneManager::GetActiveScene()->IsRunning())
-			s_physics2DEngineData->PhysicsWorld->SetContactListener(&g_ContactListener);
+		auto tilemapView = scene->GetAllEntitiesWith<TilemapComponent>();
+		for (auto e : tilemapView)
+		{
+			Entity entity = { e, scene };
+			entity.GetComponent<TilemapComponent>().MarkAllDirty();
+			UpdateTilemapColliders(entity);
+		}
+
+		if (scene->IsRunning())
+			context.PhysicsWorld->SetContactListener(&context.ContactListener);
 	}
 
 	// Fixed timestep guide: 
 	// Original Article: https://gafferongames.com/post/fix_your_timestep/
 	// Box2d Specific: https://www.unagames.com/blog/daniele/2010/06/fixed-time-step-implementation-box2d#:~:text=If%20you%20are%20interested%20in,with%20a%20variable%20frame%2Drate.
-	void Physics2DEngine::OnPhysicsUpdate(Timestep ts)
+	void Physics2DEngine::OnPhysicsUpdate(Scene* scene, Timestep ts)
 	{
+		Physics2DContext& context = GetContext(scene);
+
 		const int MAX_STEPS = 5;
-		s_physics2DEngineData->Accumulator += ts;
-		const int nSteps = glm::floor(s_physics2DEngineData->Accumulator / s_physics2DEngineData->Settings.PHYSICS_TIMESTEP);
+		context.Accumulator += ts;
+		const int nSteps = glm::floor(context.Accumulator / context.Settings.PHYSICS_TIMESTEP);
 		if (nSteps > 0)
-			s_physics2DEngineData->Accumulator -= nSteps * s_physics2DEngineData->Settings.PHYSICS_TIMESTEP;
+			context.Accumulator -= nSteps * context.Settings.PHYSICS_TIMESTEP;
 
-		s_physics2DEngineData->AccumulatorRatio = s_physics2DEngineData->Accumulator / s_physics2DEngineData->Settings.PHYSICS_TIMESTEP;
+		context.AccumulatorRatio = context.Accumulator / context.Settings.PHYSICS_TIMESTEP;
 
-		auto view = SceneManager::GetActiveScene()->GetAllEntitiesWith<Rigidbody2DComponent>();
+		// rebuild colliders of tilemap chunks edited since the last update
+		auto tilemapView = scene->GetAllEntitiesWith<TilemapComponent>();
+		{
+			ECSProfiler::ScopedView profileView(scene->GetECSProfiler(), "Physics2D Tilemap Colliders", tilemapView.size());
+			for (auto e : tilemapView)
+				UpdateTilemapColliders({ e, scene });
+		}
+
+		auto group = scene->GetGroup<Rigidbody2DComponent>(entt::get<TransformComponent>);
 		const int nStepsClamped = glm::min(nSteps, MAX_STEPS);
 		for (int i = 0; i < nStepsClamped; ++i)
 		{
 			// reset smoothing
-			for (auto e : view)
 			{
-				Entity entity = { e, SceneManager::GetActiveScene().get() };
-				auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
-
-				b2Body* body = (b2Body*)rb2d.RuntimeBody;
-				ENGINE_CORE_ASSERT(body, "Entiy has Rigidbody2DComponent, but no b2Body!");
-				if (body->GetType() == b2_staticBody)
-				{
-					continue;
-				}
-
-				auto& transform = entity.GetComponent<TransformComponent>();
-				switch (rb2d.Smoothing)
-				{
-				case Rigidbody2DComponent::SmoothingType::Interpolation:
+				ECSProfiler::ScopedView profileView(scene->GetECSProfiler(), "Physics2D Reset Smoothing", group.size());
+				group.each([](auto& rb2d, auto& transform)
 				{
-					auto& position = body->GetPosition();
-					transform.Position = glm::vec3(position.x, position.y, transform.Position.z);
-					rb2d.PreviousPosition = glm::vec2(position.x, position.y);
-					transform.Rotation.z = rb2d.PreviousAngle = body->GetAngle();
-					break;
-				}
-				case Rigidbody2DComponent::SmoothingType::Extrapolation:
-				case Rigidbody2DComponent::SmoothingType::None:
-				default:
-				{
-					auto& position = body->GetPosition();
-					transform.Position = glm::vec3(position.x, position.y, transform.Position.z);
-					transform.Rotation.z = body->GetAngle();
-					break;
-				}
-				}
+					b2Body* body = (b2Body*)rb2d.RuntimeBody;
+					ENGINE_CORE_ASSERT(body, "Entiy has Rigidbody2DComponent, but no b2Body!");
+					if (body->GetType() == b2_staticBody)
+					{
+						return;
+					}
+
+					switch (rb2d.Smoothing)
+					{
+					case Rigidbody2DComponent::SmoothingType::Interpolation:
+					{
+						auto& position = body->GetPosition();
+						transform.Position = glm::vec3(position.x, position.y, transform.Position.z);
+						rb2d.PreviousPosition = glm::vec2(position.x, position.y);
+						transform.Rotation.z = rb2d.PreviousAngle = body->GetAngle();
+						break;
+					}
+					case Rigidbody2DComponent::SmoothingType::Extrapolation:
+					case Rigidbody2DComponent::SmoothingType::None:
+					default:
+					{
+						auto& position = body->GetPosition();
+						transform.Position = glm::vec3(position.x, position.y, transform.Position.z);
+						transform.Rotation.z = body->GetAngle();
+						break;
+					}
+					}
+				});
 			}
 
-			s_physics2DEngineData->PhysicsWorld->Step(s_physics2DEngineData->Settings.PHYSICS_TIMESTEP, s_physics2DEngineData->Settings.VELOCITY_INTERACTIONS, s_physics2DEngineData->Settings.POSITION_INTERACTIONS);
-			DestroyQueuedBodiesToDestroy();
-			SetPositionQueuedBodiesToPosition();
-			SetRotationQueuedBodiesToRotate();
+			context.PhysicsWorld->Step(context.Settings.PHYSICS_TIMESTEP, context.Settings.VELOCITY_INTERACTIONS, context.Settings.POSITION_INTERACTIONS);
+			DestroyQueuedBodiesToDestroy(context);
+			SetPositionQueuedBodiesToPosition(context);
+			SetRotationQueuedBodiesToRotate(context);
 		}
 
-		s_physics2DEngineData->PhysicsWorld->ClearForces();
+		context.PhysicsWorld->ClearForces();
+		context.StepsThisUpdate = nStepsClamped;
+	}
+
+	void Physics2DEngine::ApplySmoothing(Scene* scene)
+	{
+		Physics2DContext& context = GetContext(scene);
 
 		// Smooth on Physics step only for consistent behavior in regards to framerate
-		if (nStepsClamped <= 0)
+		if (context.StepsThisUpdate <= 0)
 			return;
 
+		auto group = scene->GetGroup<Rigidbody2DComponent>(entt::get<TransformComponent>);
+
 		// apply smoothing
-		const float oneMinusRatio = 1.0f - s_physics2DEngineData->AccumulatorRatio;
+		const float oneMinusRatio = 1.0f - context.AccumulatorRatio;
 
-		for (auto e : view)
+		ECSProfiler::ScopedView profileView(scene->GetECSProfiler(), "Physics2D Apply Smoothing", group.size());
+		group.each([&](auto& rb2d, auto& transform)
 		{
-			Entity entity = { e, SceneManager::GetActiveScene().get() };
-			auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
-
 			b2Body* body = (b2Body*)rb2d.RuntimeBody;
 			ENGINE_CORE_ASSERT(body, "Entiy has Rigidbody2DComponent, but no b2Body!");
 			if (body->GetType() == b2_staticBody)
-				continue;
+				return;
 
-			auto& transform = entity.GetComponent<TransformComponent>();
 			switch (rb2d.Smoothing)
 			{
 				case Rigidbody2DComponent::SmoothingType::Interpolation:
 				{
-					auto& position = s_physics2DEngineData->AccumulatorRatio * body->GetPosition() + oneMinusRatio * b2Vec2(rb2d.PreviousPosition.x, rb2d.PreviousPosition.y);
+					auto& position = context.AccumulatorRatio * body->GetPosition() + oneMinusRatio * b2Vec2(rb2d.PreviousPosition.x, rb2d.PreviousPosition.y);
 					transform.Position = glm::vec3(position.x, position.y, transform.Position.z);
-					transform.Rotation.z = s_physics2DEngineData->AccumulatorRatio * body->GetAngle() + oneMinusRatio * rb2d.PreviousAngle;
+					transform.Rotation.z = context.AccumulatorRatio * body->GetAngle() + oneMinusRatio * rb2d.PreviousAngle;
 					break;
 				}
 				case Rigidbody2DComponent::SmoothingType::Extrapolation:
 				{
-					float dt = s_physics2DEngineData->AccumulatorRatio * s_physics2DEngineData->Settings.PHYSICS_TIMESTEP;
+					float dt = context.AccumulatorRatio * context.Settings.PHYSICS_TIMESTEP;
 					auto& position = body->GetPosition() + dt * body->GetLinearVelocity();
 					transform.Position = glm::vec3(position.x, position.y, transform.Position.z);
 					transform.Rotation.z = body->GetAngle() + dt * body->GetAngularVelocity();
@@ -225,15 +239,14 @@ namespace Engine
 					break;
 				}
 			}
-		}
+		});
 	}
 
-	void Physics2DEngine::OnPhysicsStop()
+	void Physics2DEngine::OnPhysicsStop(Scene* scene)
 	{
-		delete s_physics2DEngineData->PhysicsWorld;
-		s_physics2DEngineData->PhysicsWorld = nullptr;
-
-		delete s_physics2DEngineData;
+		Physics2DContext& context = GetContext(scene);
+		delete context.PhysicsWorld;
+		context.PhysicsWorld = nullptr;
 	}
 
 	b2Body* Physics2DEngine::CreateRigidbody(Entity entity)
@@ -253,7 +266,7 @@ namespace Engine
 		rb2d.PreviousPosition = transform.Position;
 		rb2d.PreviousAngle = transform.Rotation.z;
 
-		b2Body* body = s_physics2DEngineData->PhysicsWorld->CreateBody(&bodyDef);
+		b2Body* body = GetContext(entity.GetScene()).PhysicsWorld->CreateBody(&bodyDef);
 
 		body->SetFixedRotation(rb2d.FixedRotation);
 
@@ -262,17 +275,55 @@ namespace Engine
 
 	void Physics2DEngine::DestroyBody(Entity entity)
 	{
-		if (!entity.HasComponent<Rigidbody2DComponent>())
-			return;
+		DestroyBodies(entity.GetScene(), { entity });
+	}
 
-		b2Body* body = (b2Body*)entity.GetComponent<Rigidbody2DComponent>().RuntimeBody;
-		if (!body)
+	void Physics2DEngine::DestroyBodies(Scene* scene, const std::vector<entt::entity>& entities)
+	{
+		Physics2DContext& context = GetContext(scene);
+
+		std::vector<b2Body*> bodies;
+		for (entt::entity e : entities)
+		{
+			Entity entity = { e, scene };
+
+			if (entity.HasComponent<TilemapComponent>())
+			{
+				for (auto& [key, chunk] : entity.GetComponent<TilemapComponent>().Chunks)
+				{
+					if (chunk.RuntimeBody)
+						bodies.push_back((b2Body*)chunk.RuntimeBody);
+					chunk.RuntimeBody = nullptr;
+				}
+			}
+
+			if (entity.HasComponent<Rigidbody2DComponent>())
+			{
+				b2Body* body = (b2Body*)entity.GetComponent<Rigidbody2DComponent>().RuntimeBody;
+				if (body)
+					bodies.push_back(body);
+			}
+		}
+
+		if (context.PhysicsWorld->IsLocked())
+		{
+			context.QueuedBodiesToDestroy.insert(context.QueuedBodiesToDestroy.end(), bodies.begin(), bodies.end());
 			return;
+		}
 
-		if (s_physics2DEngineData->PhysicsWorld->IsLocked())
-			s_physics2DEngineData->QueuedBodiesToDestroy.emplace_back(body);
-		else
-			s_physics2DEngineData->PhysicsWorld->DestroyBody(body);
+		for (b2Body* body : bodies)
+			context.PhysicsWorld->DestroyBody(body);
+	}
+
+	void Physics2DEngine::DestroyTilemapBodies(Scene* scene, TilemapComponent& tilemap)
+	{
+		Physics2DContext* context = scene->GetPhysics2DContext();
+		for (auto& [key, chunk] : tilemap.Chunks)
+		{
+			if (chunk.RuntimeBody && context && context->PhysicsWorld)
+				DestroyOrQueueBody(*context, (b2Body*)chunk.RuntimeBody);
+			chunk.RuntimeBody = nullptr;
+		}
 	}
 
 	void Physics2DEngine::SetRigidbodyPosition(Entity entity, glm::vec2 position)
@@ -284,8 +335,9 @@ namespace Engine
 		if (!body)
 			return;
 
-		if (s_physics2DEngineData->PhysicsWorld->IsLocked())
-			s_physics2DEngineData->QueuedBodiesToPosition[body] = position;
+		Physics2DContext& context = GetContext(entity.GetScene());
+		if (context.PhysicsWorld->IsLocked())
+			context.QueuedBodiesToPosition[body] = position;
 		else
 			body->SetTransform({ position.x, position.y }, body->GetAngle());
 	}
@@ -299,8 +351,9 @@ namespace Engine
 		if (!body)
 			return;
 
-		if (s_physics2DEngineData->PhysicsWorld->IsLocked())
-			s_physics2DEngineData->QueuedBodiesToRotate[body] = angle;
+		Physics2DContext& context = GetContext(entity.GetScene());
+		if (context.PhysicsWorld->IsLocked())
+			context.QueuedBodiesToRotate[body] = angle;
 		else
 			body->SetTransform(body->GetPosition(), angle);
 	}
@@ -327,6 +380,107 @@ namespace Engine
 		return body->CreateFixture(&fixtureDef);
 	}
 
+	// Builds one static body per chunk with the outline of its solid tiles,
+	// merging collinear tile edges into single edge shapes
+	void Physics2DEngine::UpdateTilemapColliders(Entity entity)
+	{
+		auto& tilemap = entity.GetComponent<TilemapComponent>();
+		if (!tilemap.GenerateColliders)
+			return;
+
+		Physics2DContext& context = GetContext(entity.GetScene());
+		const int32_t chunkSize = TilemapComponent::ChunkSize;
+
+		// Same world transform DrawTilemap uses. Bodies only take position and angle,
+		// scale (and any shear from scaled parents) goes into the edge vertices.
+		const Affine2D worldTransform = entity.GetWorldSpaceAffine2D();
+		const float angle = worldTransform.GetRotation();
+		const Affine2D bodyTransform = Affine2D(glm::vec3(worldTransform.Translation, 0.0f), angle, glm::vec2(1.0f));
+		const Affine2D tileToBody = bodyTransform.Inverse() * worldTransform;
+
+		for (auto& [key, chunk] : tilemap.Chunks)
+		{
+			if (!chunk.CollidersDirty)
+				continue;
+
+			ENGINE_PROFILE_SCOPE("Physics2DEngine::UpdateTilemapColliders - Chunk");
+
+			if (chunk.RuntimeBody)
+				DestroyOrQueueBody(context, (b2Body*)chunk.RuntimeBody);
+			chunk.RuntimeBody = nullptr;
+			chunk.CollidersDirty = false;
+
+			if (chunk.IsEmpty())
+				continue;
+
+			const glm::ivec2 chunkCoords = TilemapComponent::ChunkCoordsFromKey(key);
+			const glm::ivec2 tileOrigin = chunkCoords * chunkSize;
+			auto isInside = [chunkSize](int32_t x, int32_t y) { return x >= 0 && x < chunkSize && y >= 0 && y < chunkSize; };
+			auto isSolid = [&](int32_t x, int32_t y)
+			{
+				if (isInside(x, y))
+					return chunk.Tiles[y * chunkSize + x] != TilemapComponent::EmptyTile;
+				return tilemap.GetTile(tileOrigin.x + x, tileOrigin.y + y) != TilemapComponent::EmptyTile;
+			};
+
+			b2BodyDef bodyDef;
+			bodyDef.type = b2_staticBody;
+			bodyDef.position.Set(worldTransform.Translation.x, worldTransform.Translation.y);
+			bodyDef.angle = angle;
+			bodyDef.userData.pointer = entity.GetUUID();
+			b2Body* body = context.PhysicsWorld->CreateBody(&bodyDef);
+
+			auto addEdge = [&](glm::vec2 start, glm::vec2 end)
+			{
+				start = tileToBody.Apply((glm::vec2(tileOrigin) + start) * tilemap.TileSize);
+				end = tileToBody.Apply((glm::vec2(tileOrigin) + end) * tilemap.TileSize);
+
+				b2EdgeShape edgeShape;
+				edgeShape.SetTwoSided({ start.x, start.y }, { end.x, end.y });
+				b2FixtureDef fixtureDef = CreateFixtureDef(edgeShape, 0.0f, tilemap.Friction, tilemap.Restitution, 0.5f, false);
+				body->CreateFixture(&fixtureDef);
+			};
+
+			// Chunks own the edges on the border of their own solid tiles, so shared borders are not doubled
+			for (int32_t line = 0; line <= chunkSize; ++line)
+			{
+				int32_t horizontalRun = -1, verticalRun = -1;
+				for (int32_t i = 0; i <= chunkSize; ++i)
+				{
+					bool horizontalEdge = false, verticalEdge = false;
+					if (i < chunkSize)
+					{
+						// horizontal line y = line, between tiles (i, line - 1) and (i, line)
+						bool below = isSolid(i, line - 1), above = isSolid(i, line);
+						horizontalEdge = below != above && isInside(i, below ? line - 1 : line);
+
+						// vertical line x = line, between tiles (line - 1, i) and (line, i)
+						bool left = isSolid(line - 1, i), right = isSolid(line, i);
+						verticalEdge = left != right && isInside(left ? line - 1 : line, i);
+					}
+
+					if (horizontalEdge && horizontalRun < 0)
+						horizontalRun = i;
+					else if (!horizontalEdge && horizontalRun >= 0)
+					{
+						addEdge({ (float)horizontalRun, (float)line }, { (float)i, (float)line });
+						horizontalRun = -1;
+					}
+
+					if (verticalEdge && verticalRun < 0)
+						verticalRun = i;
+					else if (!verticalEdge && verticalRun >= 0)
+					{
+						addEdge({ (float)line, (float)verticalRun }, { (float)line, (float)i });
+						verticalRun = -1;
+					}
+				}
+			}
+
+			chunk.RuntimeBody = body;
+		}
+	}
+
 	void Physics2DContactListener::BeginContact(b2Contact* contact)
 	{
 		b2Fixture* fixtureA = contact->GetFixtureA();
@@ -335,10 +489,10 @@ namespace Engine
 		UUID fixtureAEntityID = (UUID)fixtureA->GetBody()->GetUserData().pointer;
 		UUID fixtureBEntityID = (UUID)fixtureB->GetBody()->GetUserData().pointer;
 
-		if (!SceneManager::GetActiveScene()->DoesEntityExist(fixtureAEntityID) && !SceneManager::GetActiveScene()->DoesEntityExist(fixtureBEntityID))
+		if (!m_Scene->DoesEntityExist(fixtureAEntityID) && !m_Scene->DoesEntityExist(fixtureBEntityID))
 			return;
 
-		for (b2Body* body : s_physics2DEngineData->QueuedBodiesToDestroy)
+		for (b2Body* body : m_Scene->GetPhysics2DContext()->QueuedBodiesToDestroy)
 		{
 			if (fixtureA->GetBody() == body || fixtureB->GetBody() == body)
 			{
@@ -346,8 +500,8 @@ namespace Engine
 			}
 		}
 
-		Entity entityA = SceneManager::GetActiveScene()->GetEntityWithUUID(fixtureAEntityID);
-		Entity entityB = SceneManager::GetActiveScene()->GetEntityWithUUID(fixtureBEntityID);
+		Entity entityA = m_Scene->GetEntityWithUUID(fixtureAEntityID);
+		Entity entityB = m_Scene->GetEntityWithUUID(fixtureBEntityID);
 
 		if (fixtureA->IsSensor() && entityB.HasComponent<ScriptComponent>())
 		{
@@ -359,10 +513,10 @@ namespace Engine
 		}
 		else
 		{
-			if (SceneManager::GetActiveScene()->DoesEntityExist(fixtureBEntityID) && entityB.HasComponent<ScriptComponent>())
+			if (m_Scene->DoesEntityExist(fixtureBEntityID) && entityB.HasComponent<ScriptComponent>())
 				ScriptEngine::OnCollisionEnter2D(entityB, Physics2DContact{ fixtureAEntityID, fixtureBEntityID });
 			
-			if (SceneManager::GetActiveScene()->DoesEntityExist(fixtureAEntityID) && entityA.HasComponent<ScriptComponent>())
+			if (m_Scene->DoesEntityExist(fixtureAEntityID) && entityA.HasComponent<ScriptComponent>())
 				ScriptEngine::OnCollisionEnter2D(entityA, Physics2DContact{ fixtureBEntityID, fixtureAEntityID });
 		}
 	}
@@ -375,10 +529,10 @@ namespace Engine
 		UUID fixtureAEntityID = (UUID)fixtureA->GetBody()->GetUserData().pointer;
 		UUID fixtureBEntityID = (UUID)fixtureB->GetBody()->GetUserData().pointer;
 
-		if (!SceneManager::GetActiveScene()->DoesEntityExist(fixtureAEntityID) && !SceneManager::GetActiveScene()->DoesEntityExist(fixtureBEntityID))
+		if (!m_Scene->DoesEntityExist(fixtureAEntityID) && !m_Scene->DoesEntityExist(fixtureBEntityID))
 			return;
 
-		for (b2Body* body : s_physics2DEngineData->QueuedBodiesToDestroy)
+		for (b2Body* body : m_Scene->GetPhysics2DContext()->QueuedBodiesToDestroy)
 		{
 			if (fixtureA->GetBody() == body || fixtureB->GetBody() == body)
 			{
@@ -386,23 +540,23 @@ namespace Engine
 			}
 		}
 
-		Entity entityA = SceneManager::GetActiveScene()->GetEntityWithUUID(fixtureAEntityID);
-		Entity entityB = SceneManager::GetActiveScene()->GetEntityWithUUID(fixtureBEntityID);
+		Entity entityA = m_Scene->GetEntityWithUUID(fixtureAEntityID);
+		Entity entityB = m_Scene->GetEntityWithUUID(fixtureBEntityID);
 
-		if (fixtureA->IsSensor() && SceneManager::GetActiveScene()->DoesEntityExist(fixtureBEntityID) && entityB.HasComponent<ScriptComponent>())
+		if (fixtureA->IsSensor() && m_Scene->DoesEntityExist(fixtureBEntityID) && entityB.HasComponent<ScriptComponent>())
 		{
 			ScriptEngine::OnTriggerExit2D(entityB, Physics2DContact{ fixtureAEntityID, fixtureBEntityID });
 		}
-		else if (fixtureB->IsSensor() && SceneManager::GetActiveScene()->DoesEntityExist(fixtureAEntityID) && entityA.HasComponent<ScriptComponent>())
+		else if (fixtureB->IsSensor() && m_Scene->DoesEntityExist(fixtureAEntityID) && entityA.HasComponent<ScriptComponent>())
 		{
 			ScriptEngine::OnTriggerExit2D(entityA, Physics2DContact{ fixtureBEntityID, fixtureAEntityID });
 		}
 		else
 		{
-			if (SceneManager::GetActiveScene()->DoesEntityExist(fixtureBEntityID) && entityB.HasComponent<ScriptComponent>())
+			if (m_Scene->DoesEntityExist(fixtureBEntityID) && entityB.HasComponent<ScriptComponent>())
 				ScriptEngine::OnCollisionExit2D(entityB, Physics2DContact{ fixtureAEntityID, fixtureBEntityID });
 
-			if (SceneManager::GetActiveScene()->DoesEntityExist(fixtureAEntityID) && entityA.HasComponent<ScriptComponent>())
+			if (m_Scene->DoesEntityExist(fixtureAEntityID) && entityA.HasComponent<ScriptComponent>())
 				ScriptEngine::OnCollisionExit2D(entityA, Physics2DContact{ fixtureBEntityID, fixtureAEntityID });
 		}
 	}
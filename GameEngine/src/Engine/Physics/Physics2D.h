@@ -88,24 +88,64 @@ namespace Engine
 	class Physics2DEngine
 	{
 	public:
-		static void OnPhysicsStart();
-		static void OnPhysicsUpdate(Timestep ts);
-		static void OnPhysicsStop();
+		static void OnPhysicsStart(Scene* scene);
+		// Steps the world, contact callbacks call into scripts so this stays on the main thread
+		static void OnPhysicsUpdate(Scene* scene, Timestep ts);
+		// Moves transforms to the smoothed body positions of the last update, doesn't touch Mono or the world
+		static void ApplySmoothing(Scene* scene);
+		static void OnPhysicsStop(Scene* scene);
 
 		static b2Body* CreateRigidbody(Entity entity);
 		static void DestroyBody(Entity entity);
+		// Bodies of all the entities (rigidbodies and tilemap chunks) with one world lock check
+		static void DestroyBodies(Scene* scene, const std::vector<entt::entity>& entities);
+		// Chunk bodies of a tilemap being removed, safe to call when physics isn't running
+		static void DestroyTilemapBodies(Scene* scene, TilemapComponent& tilemap);
 		static void SetRigidbodyPosition(Entity entity, glm::vec2 position);
 		static void SetRigidbodyRotation(Entity entity, float angle);
 
 		static b2Fixture* CreateCollider(const TransformComponent& transform, const Rigidbody2DComponent& rb2d, const BoxCollider2DComponent& bc2d);
 		static b2Fixture* CreateCollider(const TransformComponent& transform, const Rigidbody2DComponent& rb2d, const CircleCollider2DComponent& cc2d);
+
+		static void UpdateTilemapColliders(Entity entity);
 	};
 
 	class Physics2DContactListener : public b2ContactListener
 	{
 	public:
+		Physics2DContactListener(Scene* scene)
+			: m_Scene(scene) {}
+
 		void BeginContact(b2Contact* contact) override;
 		void EndContact(b2Contact* contact) override;
+	private:
+		Scene* m_Scene;
+	};
+
+	struct PhysicsWorldSettings
+	{
+		const float PHYSICS_TIMESTEP = 1.0f / 60.0f;
+		const uint32_t VELOCITY_INTERACTIONS = 20;
+		const uint32_t POSITION_INTERACTIONS = 16;
+	};
+
+	// Physics state owned by a running scene, so scenes can step side by side
+	struct Physics2DContext
+	{
+		Physics2DContext(Scene* scene)
+			: ContactListener(scene) {}
+		~Physics2DContext() { delete PhysicsWorld; }
+
+		b2World* PhysicsWorld = nullptr;
+		Physics2DContactListener ContactListener;
+		float Accumulator = 0.0f;
+		float AccumulatorRatio = 0.0f;
+		int StepsThisUpdate = 0;
+		PhysicsWorldSettings Settings;
+
+		std::vector<b2Body*> QueuedBodiesToDestroy = std::vector<b2Body*>();
+		std::unordered_map<b2Body*, glm::vec2> QueuedBodiesToPosition = std::unordered_map<b2Body*, glm::vec2>();
+		std::unordered_map<b2Body*, float> QueuedBodiesToRotate = std::unordered_map<b2Body*, float>();
 	};
 
 	struct Physics2DContact
@@ -38,7 +38,8 @@ namespace Engine
 				project->m_SceneManager = CreateRef<EditorSceneManager>();
 			}
 			
-			AudioEngine::Init();
+			if (!Application::Get().GetSpecification().Headless)
+				AudioEngine::Init();
 
 			return s_ActiveProject;
 		}
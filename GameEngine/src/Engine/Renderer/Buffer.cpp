@@ -3,6 +3,7 @@
 
 #include "Engine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Headless/HeadlessBuffer.h"
 
 namespace Engine
 {
@@ -12,6 +13,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLVertexBuffer>(size);
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessVertexBuffer>(size);
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -24,6 +26,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLVertexBuffer>(vertices, size);
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessVertexBuffer>(vertices, size);
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -36,6 +39,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLIndexBuffer>(indices, count);
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessIndexBuffer>(indices, count);
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
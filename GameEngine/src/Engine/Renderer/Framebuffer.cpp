@@ -3,6 +3,7 @@
 
 #include "Engine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLFramebuffer.h"
+#include "Platform/Headless/HeadlessFramebuffer.h"
 
 namespace Engine
 {
@@ -12,6 +13,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLFramebuffer>(spec);
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessFramebuffer>(spec);
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
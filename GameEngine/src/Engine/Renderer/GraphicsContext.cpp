@@ -3,6 +3,7 @@
 
 #include "Engine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLContext.h"
+#include "Platform/Headless/HeadlessContext.h"
 
 namespace Engine {
 
@@ -12,6 +13,7 @@ namespace Engine {
 		{
 			case RendererAPI::API::None:    ENGINE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLContext>(static_cast<GLFWwindow*>(window));
+			case RendererAPI::API::Headless: return CreateScope<HeadlessContext>();
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
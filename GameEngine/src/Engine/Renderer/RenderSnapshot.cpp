@@ -0,0 +1,94 @@
+#include "enginepch.h"
+#include "Engine/Renderer/RenderSnapshot.h"
+
+namespace Engine
+{
+	static void SubmitPass(const RenderSnapshot::Pass& pass)
+	{
+		if (!pass.Enabled)
+			return;
+
+		Renderer2D::BeginScene(pass.ViewProjection);
+
+		for (const auto& tilemap : pass.Tilemaps)
+			Renderer2D::DrawTilemap(tilemap.Transform, *tilemap.Copy, tilemap.Tileset, tilemap.EntityID);
+
+		for (const auto& sprite : pass.Sprites)
+		{
+			if (sprite.SubTexture)
+				Renderer2D::DrawQuad(sprite.Transform, sprite.SubTexture, sprite.Tiling, sprite.Color, sprite.EntityID);
+			else if (sprite.Texture)
+				Renderer2D::DrawQuad(sprite.Transform, sprite.Texture, sprite.Tiling, sprite.Color, sprite.EntityID);
+			else
+				Renderer2D::DrawQuad(sprite.Transform, sprite.Color, sprite.EntityID);
+		}
+
+		for (const auto& circle : pass.Circles)
+			Renderer2D::DrawCircle(circle.Transform, circle.Color, circle.Thickness, circle.Fade, circle.EntityID);
+
+		for (const auto& text : pass.Texts)
+			Renderer2D::DrawString(text.String, text.Transform, text.Params, text.EntityID);
+
+		Renderer2D::EndScene();
+	}
+
+	TilemapComponent& RenderSnapshot::CopyTilemap(int entityID, const TilemapComponent& tilemap)
+	{
+		TilemapComponent& copy = TilemapCopies[entityID];
+
+		bool settingsChanged = copy.Tileset != tilemap.Tileset || copy.TilesetCellSize != tilemap.TilesetCellSize
+			|| copy.TileSize != tilemap.TileSize || copy.Color != tilemap.Color;
+
+		copy.Tileset = tilemap.Tileset;
+		copy.TilesetCellSize = tilemap.TilesetCellSize;
+		copy.TileSize = tilemap.TileSize;
+		copy.Color = tilemap.Color;
+
+		for (const auto& [key, chunk] : tilemap.Chunks)
+		{
+			auto it = copy.Chunks.find(key);
+			if (it == copy.Chunks.end())
+				copy.Chunks.emplace(key, chunk);
+			else if (it->second.Tiles != chunk.Tiles)
+				it->second = chunk;
+			else if (settingsChanged)
+				it->second.MeshDirty = true;
+		}
+
+		for (auto it = copy.Chunks.begin(); it != copy.Chunks.end();)
+		{
+			if (tilemap.Chunks.find(it->first) == tilemap.Chunks.end())
+				it = copy.Chunks.erase(it);
+			else
+				++it;
+		}
+
+		return copy;
+	}
+
+	void RenderSnapshot::PruneTilemapCopies()
+	{
+		if (TilemapCopies.size() == World.Tilemaps.size())
+			return;
+
+		std::unordered_set<int> extracted;
+		for (const auto& tilemap : World.Tilemaps)
+			extracted.insert(tilemap.EntityID);
+
+		for (auto it = TilemapCopies.begin(); it != TilemapCopies.end();)
+		{
+			if (extracted.find(it->first) == extracted.end())
+				it = TilemapCopies.erase(it);
+			else
+				++it;
+		}
+	}
+
+	void RenderSnapshot::Submit() const
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		SubmitPass(World);
+		SubmitPass(UI);
+	}
+}
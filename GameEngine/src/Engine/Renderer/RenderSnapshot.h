@@ -0,0 +1,93 @@
+#pragma once
+#include "Engine/Renderer/Renderer2D.h"
+
+#include <glm/glm.hpp>
+
+namespace Engine
+{
+	// Plain copy of everything a scene needs drawn in a frame, so it can be
+	// extracted on the main thread and submitted later (or on another thread)
+	struct RenderSnapshot
+	{
+		struct Sprite
+		{
+			Affine2D Transform;
+			glm::vec4 Color;
+			Ref<Texture2D> Texture;
+			Ref<SubTexture2D> SubTexture;
+			float Tiling;
+			int EntityID;
+		};
+
+		struct Circle
+		{
+			Affine2D Transform;
+			glm::vec4 Color;
+			float Thickness;
+			float Fade;
+			int EntityID;
+		};
+
+		struct Tilemap
+		{
+			glm::mat4 Transform;
+			Ref<Texture2D> Tileset;
+			TilemapComponent* Copy; // owned by the snapshot's TilemapCopies
+			int EntityID;
+		};
+
+		struct Text
+		{
+			std::string String;
+			glm::mat4 Transform;
+			Renderer2D::TextParams Params;
+			int EntityID;
+		};
+
+		struct Pass
+		{
+			bool Enabled = false;
+			glm::mat4 ViewProjection{ 1.0f };
+
+			std::vector<Tilemap> Tilemaps;
+			std::vector<Sprite> Sprites;
+			std::vector<Circle> Circles;
+			std::vector<Text> Texts;
+
+			void Clear()
+			{
+				Enabled = false;
+				Tilemaps.clear();
+				Sprites.clear();
+				Circles.clear();
+				Texts.clear();
+			}
+		};
+
+		Pass World;
+		Pass UI;
+
+		// Kept across Clear so chunk meshes are only rebuilt when the scene's tile pages change
+		std::unordered_map<int, TilemapComponent> TilemapCopies;
+
+		void Clear()
+		{
+			World.Clear();
+			UI.Clear();
+		}
+
+		size_t GetPrimitiveCount() const
+		{
+			return World.Tilemaps.size() + World.Sprites.size() + World.Circles.size() + World.Texts.size()
+				+ UI.Sprites.size() + UI.Circles.size() + UI.Texts.size();
+		}
+
+		// Copies the chunks whose tiles changed since the last extraction, so the render thread never reads scene tiles
+		TilemapComponent& CopyTilemap(int entityID, const TilemapComponent& tilemap);
+		// Drops the copies of tilemaps that weren't extracted this frame
+		void PruneTilemapCopies();
+
+		// Replays the snapshot through Renderer2D, must run where the graphics context is current
+		void Submit() const;
+	};
+}
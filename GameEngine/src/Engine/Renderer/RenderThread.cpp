@@ -0,0 +1,138 @@
+#include "enginepch.h"
+#include "Engine/Renderer/RenderThread.h"
+
+#include "Engine/Core/Timer.h"
+
+namespace Engine
+{
+	RenderThread::~RenderThread()
+	{
+		Stop();
+	}
+
+	void RenderThread::Start(const ConsumeFn& consume)
+	{
+		ENGINE_CORE_ASSERT(!IsRunning(), "Render thread already running!");
+
+		m_Consume = consume;
+		m_StopRequested = false;
+		m_Thread = std::thread(&RenderThread::ThreadLoop, this);
+	}
+
+	void RenderThread::Stop()
+	{
+		if (!IsRunning())
+			return;
+
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			m_StopRequested = true;
+		}
+		m_FrameReady.notify_all();
+
+		m_Thread.join();
+	}
+
+	RenderSnapshot& RenderThread::BeginFrame()
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		{
+			Timer timer;
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_FrameConsumed.wait(lock, [this] { return m_ReadingIndex != (int32_t)m_WriteIndex; });
+			m_Stats.MainThreadWaitTime += timer.ElapsedMillis();
+		}
+
+		RenderSnapshot& snapshot = m_Snapshots[m_WriteIndex];
+		snapshot.Clear();
+		return snapshot;
+	}
+
+	void RenderThread::EndFrame()
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (!IsRunning())
+		{
+			Timer timer;
+			if (m_Consume)
+				m_Consume(m_Snapshots[m_WriteIndex]);
+
+			m_Stats.ConsumeTime += timer.ElapsedMillis();
+			m_Stats.FramesSubmitted++;
+			m_Stats.FramesConsumed++;
+			return;
+		}
+
+		{
+			Timer timer;
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			// the render thread must have picked up the previous frame before it is replaced
+			m_FrameConsumed.wait(lock, [this] { return m_ReadyIndex < 0; });
+			m_Stats.MainThreadWaitTime += timer.ElapsedMillis();
+
+			m_ReadyIndex = (int32_t)m_WriteIndex;
+			m_WriteIndex ^= 1;
+			m_Stats.FramesSubmitted++;
+		}
+		m_FrameReady.notify_one();
+	}
+
+	void RenderThread::WaitIdle()
+	{
+		if (!IsRunning())
+			return;
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_FrameConsumed.wait(lock, [this] { return m_ReadyIndex < 0 && m_ReadingIndex < 0; });
+	}
+
+	RenderThread::Statistics RenderThread::GetStats()
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		return m_Stats;
+	}
+
+	void RenderThread::ResetStats()
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		m_Stats = Statistics();
+	}
+
+	void RenderThread::ThreadLoop()
+	{
+		while (true)
+		{
+			int32_t readIndex;
+			{
+				Timer timer;
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_FrameReady.wait(lock, [this] { return m_ReadyIndex >= 0 || m_StopRequested; });
+				m_Stats.RenderThreadWaitTime += timer.ElapsedMillis();
+
+				// finish the handed off frame before stopping
+				if (m_ReadyIndex < 0)
+					break;
+
+				readIndex = m_ReadingIndex = m_ReadyIndex;
+				m_ReadyIndex = -1;
+			}
+			m_FrameConsumed.notify_all();
+
+			Timer timer;
+			if (m_Consume)
+				m_Consume(m_Snapshots[readIndex]);
+			float consumeTime = timer.ElapsedMillis();
+
+			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
+				m_ReadingIndex = -1;
+				m_Stats.ConsumeTime += consumeTime;
+				m_Stats.FramesConsumed++;
+			}
+			m_FrameConsumed.notify_all();
+		}
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "Engine/Renderer/RenderSnapshot.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace Engine
+{
+	// Double-buffered snapshot handoff: the main thread fills one snapshot
+	// while the render thread consumes the other.
+	class RenderThread
+	{
+	public:
+		using ConsumeFn = std::function<void(const RenderSnapshot&)>;
+
+		RenderThread() = default;
+		~RenderThread();
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+
+		// With no thread started, EndFrame consumes the snapshot inline
+		void Start(const ConsumeFn& consume);
+		void Stop();
+		bool IsRunning() const { return m_Thread.joinable(); }
+
+		void SetConsumer(const ConsumeFn& consume) { m_Consume = consume; }
+
+		// Main thread: returns the cleared back snapshot, waiting until the render thread is done reading it
+		RenderSnapshot& BeginFrame();
+		// Main thread: hands the back snapshot to the render thread
+		void EndFrame();
+		// Main thread: blocks until every handed off snapshot has been consumed
+		void WaitIdle();
+
+		struct Statistics
+		{
+			uint64_t FramesSubmitted = 0;
+			uint64_t FramesConsumed = 0;
+			float MainThreadWaitTime = 0.0f; // ms
+			float RenderThreadWaitTime = 0.0f; // ms
+			float ConsumeTime = 0.0f; // ms
+		};
+
+		Statistics GetStats();
+		void ResetStats();
+	private:
+		void ThreadLoop();
+	private:
+		std::array<RenderSnapshot, 2> m_Snapshots;
+		uint32_t m_WriteIndex = 0;
+		int32_t m_ReadyIndex = -1;
+		int32_t m_ReadingIndex = -1;
+		bool m_StopRequested = false;
+
+		ConsumeFn m_Consume;
+		Statistics m_Stats;
+
+		std::thread m_Thread;
+		std::mutex m_Mutex;
+		std::condition_variable m_FrameReady;
+		std::condition_variable m_FrameConsumed;
+	};
+}
@@ -7,8 +7,10 @@
 #include "Engine/Renderer/RenderCommand.h"
 #include "Engine/Renderer/MSDFData.h"
 #include "Engine/Math/Math.h"
+#include "Engine/Core/Timer.h"
 
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
 
 
 namespace Engine
@@ -58,15 +60,68 @@ namespace Engine
 		int EntityID;
 	};
 	
+	struct TransparentQuad
+	{
+		QuadVertex Vertices[4];
+		uint32_t TextureIndex; // into Render2DData::TransparentTextures
+	};
+
+	struct TransparentSortEntry
+	{
+		uint32_t Key; // quantized depth, far to near
+		uint32_t Index;
+	};
+
+	// LSD radix sort over 8 bit digits, stable so equal depths keep submission order
+	static void RadixSortByKey(std::vector<TransparentSortEntry>& entries, std::vector<TransparentSortEntry>& scratch)
+	{
+		const size_t count = entries.size();
+		if (count < 2)
+			return;
+
+		scratch.resize(count);
+		TransparentSortEntry* src = entries.data();
+		TransparentSortEntry* dst = scratch.data();
+
+		for (uint32_t shift = 0; shift < 32; shift += 8)
+		{
+			uint32_t offsets[256] = {};
+			for (size_t i = 0; i < count; ++i)
+				offsets[(src[i].Key >> shift) & 0xff]++;
+
+			// every key has the same digit, nothing to move
+			if (offsets[(src[0].Key >> shift) & 0xff] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : offsets)
+			{
+				uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; ++i)
+				dst[offsets[(src[i].Key >> shift) & 0xff]++] = src[i];
+
+			std::swap(src, dst);
+		}
+
+		if (src != entries.data())
+			std::copy(src, src + count, entries.data());
+	}
+	
 	struct Render2DData
 	{
 		static const uint32_t MaxQuads = 10000;
 		static const uint32_t MaxVertices = MaxQuads * 4;
 		static const uint32_t MaxIndices = MaxQuads * 6;
 		static const uint32_t MaxTextureSlots = 32; // TODO: RenderCaps
+		static const uint32_t MaxTilemapChunkVertices = TilemapComponent::ChunkSize * TilemapComponent::ChunkSize * 4;
 		
 		Ref<VertexArray> QuadVertexArray;
 		Ref<VertexBuffer> QuadVertexBuffer;
+		Ref<IndexBuffer> QuadIndexBuffer;
 		Ref<Shader> QuadShader;
 		Ref<Texture2D> WhiteTexture;
 
@@ -98,6 +153,20 @@ namespace Engine
 		TextVertex* TextVertexBufferBase = nullptr;
 		TextVertex* TextVertexBufferPtr = nullptr;
 
+		QuadVertex* TilemapVertexBufferBase = nullptr;
+
+		// Scratch for polyline expansion
+		std::vector<glm::vec2> PolylineNormals;
+		std::vector<glm::vec2> PolylineOffsets;
+		std::vector<glm::vec3> PolylinePoints;
+
+		// Transparent pass
+		bool TransparentSorting = false;
+		std::vector<TransparentQuad> TransparentQuads;
+		std::vector<Ref<Texture2D>> TransparentTextures;
+		std::vector<TransparentSortEntry> TransparentSortEntries;
+		std::vector<TransparentSortEntry> TransparentSortScratch;
+
 		float LineWidth = 2.0f;
 
 		std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
@@ -119,6 +188,18 @@ namespace Engine
 	};
 
 	static Render2DData s_Renderer2DData;
+
+	static void GetQuadPositions(const glm::mat4& transform, glm::vec3* positions)
+	{
+		for (uint32_t i = 0; i < 4; i++)
+			positions[i] = transform * s_Renderer2DData.QuadVertexPositions[i];
+	}
+
+	static void GetQuadPositions(const Affine2D& transform, glm::vec3* positions)
+	{
+		for (uint32_t i = 0; i < 4; i++)
+			positions[i] = transform.Apply3D(glm::vec2(s_Renderer2DData.QuadVertexPositions[i]));
+	}
 	
 	void Renderer2D::Init()
 	{
@@ -156,6 +237,7 @@ namespace Engine
 
 		Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, s_Renderer2DData.MaxIndices);
 		s_Renderer2DData.QuadVertexArray->SetIndexBuffer(quadIB);
+		s_Renderer2DData.QuadIndexBuffer = quadIB;
 		delete[] quadIndices;
 
 		// Circles
@@ -200,6 +282,9 @@ namespace Engine
 		s_Renderer2DData.TextVertexBufferBase = new TextVertex[s_Renderer2DData.MaxVertices];
 		s_Renderer2DData.TextVertexArray->SetIndexBuffer(quadIB); // Use quad IB (identical implementation otherwise)
 
+		// Tilemaps (staging for chunk meshes, each chunk owns its vertex buffer)
+		s_Renderer2DData.TilemapVertexBufferBase = new QuadVertex[s_Renderer2DData.MaxTilemapChunkVertices];
+
 		uint32_t whiteTextureData = 0xffffffff;
 		s_Renderer2DData.WhiteTexture = Texture2D::Create(TextureSpecification(), Buffer(&whiteTextureData, sizeof(uint32_t)));
 
@@ -248,11 +333,22 @@ namespace Engine
 		StartBatch();
 	}
 
+	void Renderer2D::BeginScene(const glm::mat4& viewProjection)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		s_Renderer2DData.CameraBuffer.ViewProjection = viewProjection;
+		s_Renderer2DData.CameraUniformBuffer->SetData(&s_Renderer2DData.CameraBuffer, sizeof(Render2DData::CameraData));
+
+		StartBatch();
+	}
+
 	void Renderer2D::EndScene()
 	{
 		ENGINE_PROFILE_FUNCTION();
 		
 		Flush();
+		FlushTransparent();
 	}
 
 	void Renderer2D::StartBatch()
@@ -340,7 +436,7 @@ namespace Engine
 
 	void Renderer2D::DrawQuad(const glm::vec3& position, const float rotation, const glm::vec2& size, const glm::vec4& color)
 	{
-		DrawQuad(Math::GenRectTransform(position, rotation, size), color);
+		DrawQuad(Affine2D(position, rotation, size), color);
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec2& position, const float rotation, const glm::vec2& size, const Ref<Texture2D>& texture, const float tiling, const glm::vec4& color)
@@ -350,7 +446,7 @@ namespace Engine
 
 	void Renderer2D::DrawQuad(const glm::vec3& position, const float rotation, const glm::vec2& size, const Ref<Texture2D>& texture, const float tiling, const glm::vec4& color)
 	{
-		DrawQuad(Math::GenRectTransform(position, rotation, size), texture, tiling, color);
+		DrawQuad(Affine2D(position, rotation, size), texture, tiling, color);
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec2& position, const float rotation, const glm::vec2& size, const Ref<SubTexture2D>& subtexture, const float tiling, const glm::vec4& color)
@@ -361,7 +457,7 @@ namespace Engine
 	void Renderer2D::DrawQuad(const glm::vec3& position, const float rotation, const glm::vec2& size, const Ref<SubTexture2D>& subtexture, const float tiling, const glm::vec4& color)
 	{
 		
-		DrawQuad(Math::GenRectTransform(position, rotation, size), subtexture, tiling, color);
+		DrawQuad(Affine2D(position, rotation, size), subtexture, tiling, color);
 	}
 
 	void Renderer2D::DrawQuad(const glm::mat4& transform, const glm::vec4& color, int entityID)
@@ -369,8 +465,10 @@ namespace Engine
 		ENGINE_PROFILE_FUNCTION();
 
 		constexpr glm::vec2 textureCoords[] = {{ 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }};
-		
-		SetQuadVertexBuffer(transform, color, textureCoords, 0.0f, 1.0f, entityID);
+
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		SetQuadVertexBuffer(positions, color, textureCoords, 0.0f, 1.0f, entityID);
 	}
 
 	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, const float tiling, const glm::vec4& color, int entityID)
@@ -378,66 +476,76 @@ namespace Engine
 		ENGINE_PROFILE_FUNCTION();
 		
 		constexpr glm::vec2 textureCoords[] = {{ 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }};
-		
-		float textureIndex = 0.0f;
-		for (uint32_t i = 1; i < s_Renderer2DData.TextureSlotIndex; i++)
-		{
-			if (s_Renderer2DData.TextureSlots[i] == texture)
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-		
-		if (textureIndex == 0.0f)
-		{
-			if (s_Renderer2DData.TextureSlotIndex >= Render2DData::MaxTextureSlots)
-				Flush();
-			
-			textureIndex = (float)s_Renderer2DData.TextureSlotIndex;
-			ENGINE_CORE_VERIFY(texture);
-			s_Renderer2DData.TextureSlots[s_Renderer2DData.TextureSlotIndex] = texture;
-			s_Renderer2DData.TextureSlotIndex++;
-		}
-		
-		SetQuadVertexBuffer(transform, color, textureCoords, textureIndex, tiling, entityID);
+
+		float textureIndex = GetTextureIndex(texture);
+
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		SetQuadVertexBuffer(positions, color, textureCoords, textureIndex, tiling, entityID);
 	}
 
 	void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subtexture, const float tiling, const glm::vec4& color, int entityID)
 	{
 		ENGINE_PROFILE_FUNCTION();
 
-		const Ref<Texture2D> texture = subtexture->GetTexture();
-		const glm::vec2* textureCoords = subtexture->GetTexCoords();
-		
-		float textureIndex = 0.0f;
-		for (uint32_t i = 1; i < s_Renderer2DData.TextureSlotIndex; i++)
-		{
-			if (s_Renderer2DData.TextureSlots[i] == texture)
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-		
-		if (textureIndex == 0.0f)
-		{
-			if (s_Renderer2DData.TextureSlotIndex >= Render2DData::MaxTextureSlots)
-				Flush();
-			
-			textureIndex = (float)s_Renderer2DData.TextureSlotIndex;
-			s_Renderer2DData.TextureSlots[s_Renderer2DData.TextureSlotIndex] = texture;
-			s_Renderer2DData.TextureSlotIndex++;
-		}
-		
-		SetQuadVertexBuffer(transform, color, textureCoords, textureIndex, tiling, entityID);
+		float textureIndex = GetTextureIndex(subtexture->GetTexture());
+
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		SetQuadVertexBuffer(positions, color, subtexture->GetTexCoords(), textureIndex, tiling, entityID);
 	}
 
 	void Renderer2D::DrawCircle(const glm::mat4& transform, const glm::vec4& color, const float thickness, const float fade, int entityID)
 	{
 		ENGINE_PROFILE_FUNCTION();
 
-		SetCircleVertexBuffer(transform, color, thickness, fade, entityID);
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		SetCircleVertexBuffer(positions, color, thickness, fade, entityID);
+	}
+
+	void Renderer2D::DrawQuad(const Affine2D& transform, const glm::vec4& color, int entityID)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		constexpr glm::vec2 textureCoords[] = {{ 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }};
+
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		SetQuadVertexBuffer(positions, color, textureCoords, 0.0f, 1.0f, entityID);
+	}
+
+	void Renderer2D::DrawQuad(const Affine2D& transform, const Ref<Texture2D>& texture, const float tiling, const glm::vec4& color, int entityID)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		constexpr glm::vec2 textureCoords[] = {{ 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }};
+
+		float textureIndex = GetTextureIndex(texture);
+
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		SetQuadVertexBuffer(positions, color, textureCoords, textureIndex, tiling, entityID);
+	}
+
+	void Renderer2D::DrawQuad(const Affine2D& transform, const Ref<SubTexture2D>& subtexture, const float tiling, const glm::vec4& color, int entityID)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		float textureIndex = GetTextureIndex(subtexture->GetTexture());
+
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		SetQuadVertexBuffer(positions, color, subtexture->GetTexCoords(), textureIndex, tiling, entityID);
+	}
+
+	void Renderer2D::DrawCircle(const Affine2D& transform, const glm::vec4& color, const float thickness, const float fade, int entityID)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		SetCircleVertexBuffer(positions, color, thickness, fade, entityID);
 	}
 
 	void Renderer2D::DrawLine(const glm::vec3& pos0, const glm::vec3& pos1, const glm::vec4& color, int entityID)
@@ -476,6 +584,98 @@ namespace Engine
 		DrawLine(lineVertices[3], lineVertices[0], color, entityID);
 	}
 
+	void Renderer2D::DrawThickLine(const glm::vec3& pos0, const glm::vec3& pos1, const glm::vec4& color, const float width, int entityID)
+	{
+		const glm::vec3 points[2] = { pos0, pos1 };
+		DrawPolyline(points, 2, color, width, false, entityID);
+	}
+
+	void Renderer2D::DrawPolyline(const glm::vec3* points, uint32_t pointCount, const glm::vec4& color, const float width, bool closed, int entityID)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (pointCount < 2)
+			return;
+
+		const float halfWidth = width * 0.5f;
+		const uint32_t segmentCount = closed ? pointCount : pointCount - 1;
+
+		// Segment normals, degenerate segments reuse the previous normal
+		auto& normals = s_Renderer2DData.PolylineNormals;
+		normals.resize(segmentCount);
+		glm::vec2 normal{ 0.0f, 1.0f };
+		for (uint32_t i = 0; i < segmentCount; ++i)
+		{
+			glm::vec2 direction = glm::vec2(points[(i + 1) % pointCount]) - glm::vec2(points[i]);
+			float length = glm::length(direction);
+			if (length > 1e-6f)
+				normal = { -direction.y / length, direction.x / length };
+			normals[i] = normal;
+		}
+
+		// Miter joins, limited so sharp corners don't spike
+		auto& offsets = s_Renderer2DData.PolylineOffsets;
+		offsets.resize(pointCount);
+		for (uint32_t i = 0; i < pointCount; ++i)
+		{
+			const bool hasPrev = closed || i > 0;
+			const bool hasNext = closed || i < pointCount - 1;
+			const glm::vec2 nextNormal = hasNext ? normals[i % segmentCount] : normals[i - 1];
+			const glm::vec2 prevNormal = hasPrev ? normals[(i + segmentCount - 1) % segmentCount] : nextNormal;
+
+			glm::vec2 miter = prevNormal + nextNormal;
+			float miterLength = glm::length(miter);
+			if (miterLength < 1e-6f)
+			{
+				offsets[i] = nextNormal * halfWidth;
+				continue;
+			}
+
+			miter /= miterLength;
+			offsets[i] = miter * (halfWidth / glm::max(glm::dot(miter, nextNormal), 0.25f));
+		}
+
+		for (uint32_t i = 0; i < segmentCount; ++i)
+		{
+			const uint32_t a = i;
+			const uint32_t b = (i + 1) % pointCount;
+			const glm::vec3 offsetA{ offsets[a], 0.0f };
+			const glm::vec3 offsetB{ offsets[b], 0.0f };
+
+			const glm::vec3 positions[4] = { points[a] - offsetA, points[b] - offsetB, points[b] + offsetB, points[a] + offsetA };
+			SetQuadVertexBuffer(positions, color, entityID);
+		}
+	}
+
+	void Renderer2D::DrawPolyline(const std::vector<glm::vec3>& points, const glm::vec4& color, const float width, bool closed, int entityID)
+	{
+		DrawPolyline(points.data(), (uint32_t)points.size(), color, width, closed, entityID);
+	}
+
+	void Renderer2D::DrawRectOutline(const glm::mat4& transform, const glm::vec4& color, const float width, int entityID)
+	{
+		glm::vec3 points[4];
+		for (size_t i = 0; i < 4; ++i)
+		{
+			points[i] = transform * s_Renderer2DData.QuadVertexPositions[i];
+		}
+
+		DrawPolyline(points, 4, color, width, true, entityID);
+	}
+
+	void Renderer2D::DrawCircleOutline(const glm::mat4& transform, const glm::vec4& color, const float width, uint32_t segments, int entityID)
+	{
+		auto& points = s_Renderer2DData.PolylinePoints;
+		points.resize(glm::max(segments, 3u));
+		for (uint32_t i = 0; i < points.size(); ++i)
+		{
+			float angle = glm::two_pi<float>() * (float)i / (float)points.size();
+			points[i] = transform * glm::vec4(glm::cos(angle) * 0.5f, glm::sin(angle) * 0.5f, 0.0f, 1.0f);
+		}
+
+		DrawPolyline(points, color, width, true, entityID);
+	}
+
 	void Renderer2D::DrawSprite(const glm::mat4& transform, SpriteRendererComponent& src, int entityID)
 	{
 		ENGINE_PROFILE_FUNCTION();
@@ -497,6 +697,70 @@ namespace Engine
 		}
 	}
 
+	void Renderer2D::DrawSprite(const Affine2D& transform, SpriteRendererComponent& src, int entityID)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (src.Texture.IsValid())
+		{
+			if (src.IsSubTexture)
+			{
+				DrawQuad(transform, src.SubTexture, src.Tiling, src.Color, entityID);
+			}
+			else
+			{
+				DrawQuad(transform, src.GetTexture2D(), src.Tiling, src.Color, entityID);
+			}
+		}
+		else
+		{
+			DrawQuad(transform, src.Color, entityID);
+		}
+	}
+
+	void Renderer2D::DrawTilemap(const glm::mat4& transform, TilemapComponent& tilemap, int entityID)
+	{
+		DrawTilemap(transform, tilemap, tilemap.GetTileset(), entityID);
+	}
+
+	void Renderer2D::DrawTilemap(const glm::mat4& transform, TilemapComponent& tilemap, const Ref<Texture2D>& tileset, int entityID)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (tilemap.Chunks.empty())
+			return;
+
+		// Chunk meshes are drawn directly, flush what is batched so far to keep draw order
+		NextBatch();
+
+		(tileset ? tileset : s_Renderer2DData.WhiteTexture)->Bind(0);
+		s_Renderer2DData.QuadShader->Bind();
+
+		const glm::vec2 chunkExtent = tilemap.TileSize * (float)TilemapComponent::ChunkSize;
+		for (auto& [key, chunk] : tilemap.Chunks)
+		{
+			glm::ivec2 chunkCoords = TilemapComponent::ChunkCoordsFromKey(key);
+			glm::vec2 chunkMin = glm::vec2(chunkCoords) * chunkExtent;
+			if (!IsRectVisible(transform, chunkMin, chunkMin + chunkExtent))
+			{
+				s_Renderer2DData.Stats.TilemapChunksCulled++;
+				continue;
+			}
+
+			if (chunk.MeshDirty || chunk.MeshTransform != transform)
+				BuildTilemapChunkMesh(transform, tilemap, chunk, chunkCoords, tileset, entityID);
+
+			if (chunk.QuadCount == 0)
+				continue;
+
+			RenderCommand::DrawIndexed(chunk.RuntimeVertexArray, chunk.QuadCount * 6);
+
+			s_Renderer2DData.Stats.DrawCalls++;
+			s_Renderer2DData.Stats.QuadCount += chunk.QuadCount;
+			s_Renderer2DData.Stats.TilemapChunksDrawn++;
+		}
+	}
+
 	void Renderer2D::DrawString(const std::string& string, const glm::mat4& transform, const TextParams& textParams, int entityID)
 	{
 		ENGINE_PROFILE_FUNCTION();
@@ -625,16 +889,50 @@ namespace Engine
 		s_Renderer2DData.LineWidth = width;
 	}
 
-	void Renderer2D::SetQuadVertexBuffer(const glm::mat4& transform, const glm::vec4& color,  const glm::vec2* textureCoords, const float textureIndex, const float tiling, int entityID)
+	bool Renderer2D::GetTransparentSorting()
+	{
+		return s_Renderer2DData.TransparentSorting;
+	}
+
+	void Renderer2D::SetTransparentSorting(bool enabled)
+	{
+		s_Renderer2DData.TransparentSorting = enabled;
+	}
+
+	float Renderer2D::GetTextureIndex(const Ref<Texture2D>& texture)
+	{
+		for (uint32_t i = 1; i < s_Renderer2DData.TextureSlotIndex; i++)
+		{
+			if (s_Renderer2DData.TextureSlots[i] == texture)
+				return (float)i;
+		}
+
+		if (s_Renderer2DData.TextureSlotIndex >= Render2DData::MaxTextureSlots)
+			Flush();
+
+		float textureIndex = (float)s_Renderer2DData.TextureSlotIndex;
+		ENGINE_CORE_VERIFY(texture);
+		s_Renderer2DData.TextureSlots[s_Renderer2DData.TextureSlotIndex] = texture;
+		s_Renderer2DData.TextureSlotIndex++;
+		return textureIndex;
+	}
+
+	void Renderer2D::SetQuadVertexBuffer(const glm::vec3* positions, const glm::vec4& color,  const glm::vec2* textureCoords, const float textureIndex, const float tiling, int entityID)
 	{
 		ENGINE_PROFILE_FUNCTION();
 
+		if (s_Renderer2DData.TransparentSorting && (color.a < 1.0f || s_Renderer2DData.TextureSlots[(uint32_t)textureIndex]->HasAlpha()))
+		{
+			SubmitTransparentQuad(positions, color, textureCoords, textureIndex, tiling, entityID);
+			return;
+		}
+
 		if (s_Renderer2DData.QuadIndexCount >= Render2DData::MaxIndices)
 			NextBatch();
 		
 		for (uint32_t i = 0; i < 4; i++)
 		{
-			s_Renderer2DData.QuadVertexBufferPtr->Position = transform * s_Renderer2DData.QuadVertexPositions[i];
+			s_Renderer2DData.QuadVertexBufferPtr->Position = positions[i];
 			s_Renderer2DData.QuadVertexBufferPtr->Color = color;
 			s_Renderer2DData.QuadVertexBufferPtr->TexCoord = textureCoords[i];
 			s_Renderer2DData.QuadVertexBufferPtr->TilingFactor = tiling;
@@ -647,7 +945,124 @@ namespace Engine
 		s_Renderer2DData.Stats.QuadCount++;
 	}
 
-	void Renderer2D::SetCircleVertexBuffer(const glm::mat4& transform, const glm::vec4& color, const float thickness, const float fade, int entityID)
+	void Renderer2D::SetQuadVertexBuffer(const glm::vec3* positions, const glm::vec4& color, int entityID)
+	{
+		if (s_Renderer2DData.QuadIndexCount >= Render2DData::MaxIndices)
+			NextBatch();
+
+		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			s_Renderer2DData.QuadVertexBufferPtr->Position = positions[i];
+			s_Renderer2DData.QuadVertexBufferPtr->Color = color;
+			s_Renderer2DData.QuadVertexBufferPtr->TexCoord = textureCoords[i];
+			s_Renderer2DData.QuadVertexBufferPtr->TilingFactor = 1.0f;
+			s_Renderer2DData.QuadVertexBufferPtr->TexureIndex = 0.0f; // white texture
+			s_Renderer2DData.QuadVertexBufferPtr->EntityID = entityID;
+			s_Renderer2DData.QuadVertexBufferPtr++;
+		}
+
+		s_Renderer2DData.QuadIndexCount += 6;
+		s_Renderer2DData.Stats.QuadCount++;
+	}
+
+	void Renderer2D::SubmitTransparentQuad(const glm::vec3* positions, const glm::vec4& color, const glm::vec2* textureCoords, const float textureIndex, const float tiling, int entityID)
+	{
+		const Ref<Texture2D>& texture = s_Renderer2DData.TextureSlots[(uint32_t)textureIndex];
+		auto& textures = s_Renderer2DData.TransparentTextures;
+		auto textureIt = std::find(textures.begin(), textures.end(), texture);
+		if (textureIt == textures.end())
+			textureIt = textures.insert(textures.end(), texture);
+
+		TransparentQuad& quad = s_Renderer2DData.TransparentQuads.emplace_back();
+		quad.TextureIndex = (uint32_t)(textureIt - textures.begin());
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			quad.Vertices[i].Position = positions[i];
+			quad.Vertices[i].Color = color;
+			quad.Vertices[i].TexCoord = textureCoords[i];
+			quad.Vertices[i].TilingFactor = tiling;
+			quad.Vertices[i].EntityID = entityID;
+		}
+
+		// Depth of the quad center mapped to [0, 1], 0 = near plane. Keys sort ascending, so (1 - depth) draws far to near.
+		glm::vec3 center = (positions[0] + positions[2]) * 0.5f;
+		glm::vec4 clip = s_Renderer2DData.CameraBuffer.ViewProjection * glm::vec4(center, 1.0f);
+		double depth = clip.w > 0.0f ? glm::clamp(clip.z / clip.w * 0.5f + 0.5f, 0.0f, 1.0f) : 1.0f;
+
+		TransparentSortEntry entry;
+		entry.Key = (uint32_t)((1.0 - depth) * (double)UINT32_MAX);
+		entry.Index = (uint32_t)s_Renderer2DData.TransparentQuads.size() - 1;
+		s_Renderer2DData.TransparentSortEntries.push_back(entry);
+
+		s_Renderer2DData.Stats.QuadCount++;
+		s_Renderer2DData.Stats.TransparentQuadCount++;
+	}
+
+	void Renderer2D::FlushTransparent()
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (s_Renderer2DData.TransparentQuads.empty())
+			return;
+
+		{
+			ENGINE_PROFILE_SCOPE("Renderer2D::FlushTransparent - Sort");
+
+			Timer timer;
+			RadixSortByKey(s_Renderer2DData.TransparentSortEntries, s_Renderer2DData.TransparentSortScratch);
+			s_Renderer2DData.Stats.TransparentSortTime += timer.ElapsedMillis();
+		}
+
+		StartBatch();
+
+		for (const TransparentSortEntry& entry : s_Renderer2DData.TransparentSortEntries)
+		{
+			const TransparentQuad& quad = s_Renderer2DData.TransparentQuads[entry.Index];
+			const Ref<Texture2D>& texture = s_Renderer2DData.TransparentTextures[quad.TextureIndex];
+
+			if (s_Renderer2DData.QuadIndexCount >= Render2DData::MaxIndices)
+				NextBatch();
+
+			float textureIndex = -1.0f;
+			for (uint32_t i = 0; i < s_Renderer2DData.TextureSlotIndex; i++)
+			{
+				if (s_Renderer2DData.TextureSlots[i] == texture)
+				{
+					textureIndex = (float)i;
+					break;
+				}
+			}
+
+			if (textureIndex < 0.0f)
+			{
+				if (s_Renderer2DData.TextureSlotIndex >= Render2DData::MaxTextureSlots)
+					NextBatch();
+
+				textureIndex = (float)s_Renderer2DData.TextureSlotIndex;
+				s_Renderer2DData.TextureSlots[s_Renderer2DData.TextureSlotIndex] = texture;
+				s_Renderer2DData.TextureSlotIndex++;
+			}
+
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				*s_Renderer2DData.QuadVertexBufferPtr = quad.Vertices[i];
+				s_Renderer2DData.QuadVertexBufferPtr->TexureIndex = textureIndex;
+				s_Renderer2DData.QuadVertexBufferPtr++;
+			}
+
+			s_Renderer2DData.QuadIndexCount += 6;
+		}
+
+		Flush();
+
+		s_Renderer2DData.TransparentQuads.clear();
+		s_Renderer2DData.TransparentTextures.clear();
+		s_Renderer2DData.TransparentSortEntries.clear();
+	}
+
+	void Renderer2D::SetCircleVertexBuffer(const glm::vec3* positions, const glm::vec4& color, const float thickness, const float fade, int entityID)
 	{
 		ENGINE_PROFILE_FUNCTION();
 
@@ -656,7 +1071,7 @@ namespace Engine
 
 		for (uint32_t i = 0; i < 4; i++)
 		{
-			s_Renderer2DData.CircleVertexBufferPtr->WorldPosition = transform * s_Renderer2DData.QuadVertexPositions[i];
+			s_Renderer2DData.CircleVertexBufferPtr->WorldPosition = positions[i];
 			s_Renderer2DData.CircleVertexBufferPtr->LocalPosition = s_Renderer2DData.QuadVertexPositions[i] * 2.0f;
 			s_Renderer2DData.CircleVertexBufferPtr->Color = color;
 			s_Renderer2DData.CircleVertexBufferPtr->Thickness = thickness;
@@ -669,6 +1084,101 @@ namespace Engine
 		s_Renderer2DData.Stats.QuadCount++;
 	}
 
+	void Renderer2D::BuildTilemapChunkMesh(const glm::mat4& transform, TilemapComponent& tilemap, TilemapComponent::Chunk& chunk, const glm::ivec2& chunkCoords, const Ref<Texture2D>& tileset, int entityID)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (!chunk.RuntimeVertexArray)
+		{
+			chunk.RuntimeVertexArray = VertexArray::Create();
+			chunk.RuntimeVertexBuffer = VertexBuffer::Create(Render2DData::MaxTilemapChunkVertices * sizeof(QuadVertex));
+			chunk.RuntimeVertexBuffer->SetLayout(s_Renderer2DData.QuadVertexBuffer->GetLayout());
+			chunk.RuntimeVertexArray->AddVertexBuffer(chunk.RuntimeVertexBuffer);
+			chunk.RuntimeVertexArray->SetIndexBuffer(s_Renderer2DData.QuadIndexBuffer);
+		}
+
+		glm::vec2 textureSize{ 1.0f };
+		glm::vec2 cellUV{ 1.0f };
+		int32_t columns = 1, rows = 1;
+		if (tileset)
+		{
+			textureSize = { (float)tileset->GetWidth(), (float)tileset->GetHeight() };
+			columns = glm::max(1, (int32_t)(textureSize.x / tilemap.TilesetCellSize.x));
+			rows = glm::max(1, (int32_t)(textureSize.y / tilemap.TilesetCellSize.y));
+			cellUV = tilemap.TilesetCellSize / textureSize;
+		}
+
+		const glm::vec2 chunkOrigin = glm::vec2(chunkCoords) * tilemap.TileSize * (float)TilemapComponent::ChunkSize;
+
+		QuadVertex* vertexPtr = s_Renderer2DData.TilemapVertexBufferBase;
+		uint32_t quadCount = 0;
+		for (int32_t y = 0; y < TilemapComponent::ChunkSize; ++y)
+		{
+			for (int32_t x = 0; x < TilemapComponent::ChunkSize; ++x)
+			{
+				int32_t tile = chunk.Tiles[y * TilemapComponent::ChunkSize + x];
+				if (tile == TilemapComponent::EmptyTile)
+					continue;
+
+				// tile 0 is the top left cell of the tileset
+				glm::vec2 uvMin{ 0.0f };
+				if (tileset)
+					uvMin = { (float)(tile % columns) * cellUV.x, (float)(rows - 1 - (tile / columns) % rows) * cellUV.y };
+
+				const glm::vec2 tileMin = chunkOrigin + glm::vec2((float)x, (float)y) * tilemap.TileSize;
+				const glm::vec2 positions[4] = { tileMin, { tileMin.x + tilemap.TileSize.x, tileMin.y }, tileMin + tilemap.TileSize, { tileMin.x, tileMin.y + tilemap.TileSize.y } };
+				const glm::vec2 textureCoords[4] = { uvMin, { uvMin.x + cellUV.x, uvMin.y }, uvMin + cellUV, { uvMin.x, uvMin.y + cellUV.y } };
+
+				for (uint32_t i = 0; i < 4; i++)
+				{
+					vertexPtr->Position = transform * glm::vec4(positions[i], 0.0f, 1.0f);
+					vertexPtr->Color = tilemap.Color;
+					vertexPtr->TexCoord = textureCoords[i];
+					vertexPtr->TilingFactor = 1.0f;
+					vertexPtr->TexureIndex = 0.0f; // tileset is bound to slot 0 while drawing chunks
+					vertexPtr->EntityID = entityID;
+					vertexPtr++;
+				}
+
+				quadCount++;
+			}
+		}
+
+		if (quadCount > 0)
+			chunk.RuntimeVertexBuffer->SetData(s_Renderer2DData.TilemapVertexBufferBase, quadCount * 4 * sizeof(QuadVertex));
+
+		chunk.QuadCount = quadCount;
+		chunk.MeshTransform = transform;
+		chunk.MeshDirty = false;
+	}
+
+	bool Renderer2D::IsRectVisible(const glm::mat4& transform, const glm::vec2& min, const glm::vec2& max)
+	{
+		const glm::mat4 mvp = s_Renderer2DData.CameraBuffer.ViewProjection * transform;
+		const glm::vec4 corners[4] = {
+			mvp * glm::vec4(min.x, min.y, 0.0f, 1.0f),
+			mvp * glm::vec4(max.x, min.y, 0.0f, 1.0f),
+			mvp * glm::vec4(max.x, max.y, 0.0f, 1.0f),
+			mvp * glm::vec4(min.x, max.y, 0.0f, 1.0f)
+		};
+
+		// Rect is hidden only if every corner is outside the same clip plane
+		for (int axis = 0; axis < 2; ++axis)
+		{
+			bool allBelow = true, allAbove = true;
+			for (const glm::vec4& corner : corners)
+			{
+				allBelow &= corner[axis] < -corner.w;
+				allAbove &= corner[axis] > corner.w;
+			}
+
+			if (allBelow || allAbove)
+				return false;
+		}
+
+		return true;
+	}
+
 	void Renderer2D::ResetStats()
 	{
 		memset(&s_Renderer2DData.Stats, 0, sizeof(Statistics));
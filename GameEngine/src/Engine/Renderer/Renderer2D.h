@@ -8,6 +8,7 @@
 #include "Engine/Renderer/SubTexture2D.h"
 #include "Engine/Renderer/Font.h"
 #include "Engine/Scene/Components.h"
+#include "Engine/Math/Affine2D.h"
 
 namespace Engine
 {
@@ -20,6 +21,7 @@ namespace Engine
 		
 		static void BeginScene(const Camera& camera, const glm::mat4& transform);
 		static void BeginScene(const EditorCamera& camera);
+		static void BeginScene(const glm::mat4& viewProjection);
 		static void EndScene();
 		static void Flush();
 
@@ -37,11 +39,28 @@ namespace Engine
 		
 		static void DrawCircle(const glm::mat4& transform = glm::mat4(1.0f), const glm::vec4& color = glm::vec4(1.0f), const float thickness = 1.0f, const float fade = 0.005f, int entityID = -1);
 
+		// 2D transforms, the quad corners come from the affine columns instead of four mat4 * vec4
+		static void DrawQuad(const Affine2D& transform, const glm::vec4& color = glm::vec4(1.0f), int entityID = -1);
+		static void DrawQuad(const Affine2D& transform, const Ref<Texture2D>& texture, const float tiling = 1.0f, const glm::vec4& color = glm::vec4(1.0f), int entityID = -1);
+		static void DrawQuad(const Affine2D& transform, const Ref<SubTexture2D>& subtexture, const float tiling = 1.0f, const glm::vec4& color = glm::vec4(1.0f), int entityID = -1);
+		static void DrawCircle(const Affine2D& transform, const glm::vec4& color = glm::vec4(1.0f), const float thickness = 1.0f, const float fade = 0.005f, int entityID = -1);
+
 		static void DrawLine(const glm::vec3& pos0, const glm::vec3& pos1, const glm::vec4& color = glm::vec4(1.0f), int entityID = -1);
 		static void DrawRect(const glm::vec3& position = glm::vec3(0.0f), const float rotation = 0.0f, const glm::vec2& size = glm::vec2(1.0f), const glm::vec4& color = glm::vec4(1.0f), int entityID = -1);
 		static void DrawRect(const glm::mat4& transform = glm::mat4(1.0f), const glm::vec4& color = glm::vec4(1.0f), int entityID = -1);
 
+		// Thick lines, expanded into quads in world units and batched with the quads
+		static void DrawThickLine(const glm::vec3& pos0, const glm::vec3& pos1, const glm::vec4& color, const float width, int entityID = -1);
+		static void DrawPolyline(const glm::vec3* points, uint32_t pointCount, const glm::vec4& color, const float width, bool closed = false, int entityID = -1);
+		static void DrawPolyline(const std::vector<glm::vec3>& points, const glm::vec4& color, const float width, bool closed = false, int entityID = -1);
+		static void DrawRectOutline(const glm::mat4& transform, const glm::vec4& color, const float width, int entityID = -1);
+		static void DrawCircleOutline(const glm::mat4& transform, const glm::vec4& color, const float width, uint32_t segments = 32, int entityID = -1);
+
 		static void DrawSprite(const glm::mat4& transform, SpriteRendererComponent& src, int entityID);
+		static void DrawSprite(const Affine2D& transform, SpriteRendererComponent& src, int entityID);
+		static void DrawTilemap(const glm::mat4& transform, TilemapComponent& tilemap, int entityID);
+		// Tileset resolved by the caller, for threads that can't touch the AssetManager
+		static void DrawTilemap(const glm::mat4& transform, TilemapComponent& tilemap, const Ref<Texture2D>& tileset, int entityID);
 
 		struct TextParams
 		{
@@ -56,12 +75,20 @@ namespace Engine
 
 		static float GetLineWidth();
 		static void SetLineWidth(float width);
+
+		// Translucent quads are deferred and drawn back-to-front at EndScene
+		static bool GetTransparentSorting();
+		static void SetTransparentSorting(bool enabled);
 		
 		// Stats
 		struct Statistics
 		{
 			uint32_t DrawCalls = 0;
 			uint32_t QuadCount = 0;
+			uint32_t TilemapChunksDrawn = 0;
+			uint32_t TilemapChunksCulled = 0;
+			uint32_t TransparentQuadCount = 0;
+			float TransparentSortTime = 0.0f; // ms
 			
 			uint32_t GetTotalVertexCount() const { return QuadCount * 4; }
 			uint32_t GetTotalIndexCount() const { return QuadCount * 6; }
@@ -72,8 +99,14 @@ namespace Engine
 	private:
 		static void StartBatch();
 		static void NextBatch();
-		static void SetQuadVertexBuffer(const glm::mat4& transfrom, const glm::vec4& color, const glm::vec2* textureCoords, const float textureIndex, const float tiling, int entityID);
-		static void SetCircleVertexBuffer(const glm::mat4& transfrom, const glm::vec4& color, const float thickness, const float fade, int entityID);
+		static float GetTextureIndex(const Ref<Texture2D>& texture);
+		static void SetQuadVertexBuffer(const glm::vec3* positions, const glm::vec4& color, const glm::vec2* textureCoords, const float textureIndex, const float tiling, int entityID);
+		static void SetQuadVertexBuffer(const glm::vec3* positions, const glm::vec4& color, int entityID);
+		static void SubmitTransparentQuad(const glm::vec3* positions, const glm::vec4& color, const glm::vec2* textureCoords, const float textureIndex, const float tiling, int entityID);
+		static void FlushTransparent();
+		static void SetCircleVertexBuffer(const glm::vec3* positions, const glm::vec4& color, const float thickness, const float fade, int entityID);
+		static void BuildTilemapChunkMesh(const glm::mat4& transform, TilemapComponent& tilemap, TilemapComponent::Chunk& chunk, const glm::ivec2& chunkCoords, const Ref<Texture2D>& tileset, int entityID);
+		static bool IsRectVisible(const glm::mat4& transform, const glm::vec2& min, const glm::vec2& max);
 	};
 	
 }
@@ -2,6 +2,7 @@
 #include "Engine/Renderer/RendererAPI.h"
 
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Headless/HeadlessRendererAPI.h"
 
 namespace Engine
 {
@@ -13,6 +14,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:    ENGINE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLRendererAPI>();
+			case RendererAPI::API::Headless: return CreateScope<HeadlessRendererAPI>();
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
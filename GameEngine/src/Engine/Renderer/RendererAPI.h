@@ -11,7 +11,7 @@ namespace Engine
 	public:
 		enum class API
 		{
-			None = 0, OpenGL = 1
+			None = 0, OpenGL = 1, Headless = 2
 		};
 	public:
 		virtual ~RendererAPI() = default;
@@ -27,6 +27,8 @@ namespace Engine
 		virtual void SetLineWidth(float width) = 0;
 
 		inline static API GetAPI() {return s_API; }
+		// Must be set before Renderer::Init, resources created under another API are not converted
+		static void SetAPI(API api) { s_API = api; }
 		static Scope<RendererAPI> Create();
 	private:
 		static API s_API;
@@ -3,6 +3,7 @@
 
 #include "Engine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Headless/HeadlessShader.h"
 
 namespace Engine
 {
@@ -14,6 +15,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLShader>(filepath);
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessShader>(filepath);
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -26,6 +28,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessShader>(name, vertexSrc, fragmentSrc);
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
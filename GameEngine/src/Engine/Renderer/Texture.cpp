@@ -4,15 +4,47 @@
 
 #include "Engine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Headless/HeadlessTexture.h"
 
 namespace Engine
 {
+	bool Texture::DataHasAlpha(ImageFormat format, Buffer data)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		switch (format)
+		{
+			case ImageFormat::RGBA8:
+			{
+				for (uint64_t i = 3; i < data.Size; i += 4)
+				{
+					if (data.Data[i] != 255)
+						return true;
+				}
+				return false;
+			}
+			case ImageFormat::RGBA32F:
+			{
+				const float* pixels = data.As<float>();
+				for (uint64_t i = 3; i < data.Size / sizeof(float); i += 4)
+				{
+					if (pixels[i] < 1.0f)
+						return true;
+				}
+				return false;
+			}
+			default:
+				return false;
+		}
+	}
+
 	Ref<Texture2D> Texture2D::Create(const TextureSpecification& specification, Buffer data)
 	{
 		switch (Renderer::GetAPI())
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLTexture2D>(specification, data);
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessTexture2D>(specification, data);
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
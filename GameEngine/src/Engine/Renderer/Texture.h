@@ -33,10 +33,14 @@ namespace Engine
 		virtual uint32_t GetRendererID() const = 0;
 
 		virtual void SetData(Buffer data) = 0;
+		// Any pixel with alpha below 1 in the last SetData, such textures need blending
+		virtual bool HasAlpha() const = 0;
 		
 		virtual void Bind(uint32_t slot = 0) const = 0;
 		
 		virtual bool operator==(const Texture& other) const = 0;
+	protected:
+		static bool DataHasAlpha(ImageFormat format, Buffer data);
 	};
 
 	class Texture2D : public Texture
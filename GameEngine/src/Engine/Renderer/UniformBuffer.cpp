@@ -4,6 +4,7 @@
 #include "Engine/Renderer/Renderer.h"
 
 #include "Platform/OpenGL/OpenGLUniformBuffer.h"
+#include "Platform/Headless/HeadlessUniformBuffer.h"
 
 namespace Engine
 {
@@ -13,6 +14,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLUniformBuffer>(size, binding);
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessUniformBuffer>(size, binding);
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!")
@@ -3,6 +3,7 @@
 		  
 #include "Engine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "Platform/Headless/HeadlessVertexArray.h"
 
 namespace Engine
 {
@@ -12,6 +13,7 @@ namespace Engine
 		{
 			case RendererAPI::API::None:		ENGINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not supported!");  return nullptr;
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGLVertexArray>();
+			case RendererAPI::API::Headless:		return CreateRef<HeadlessVertexArray>();
 		}
 
 		ENGINE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -1,9 +1,11 @@
 #pragma once
 #include "Engine/Asset/AssetManager.h"
 #include "Engine/Core/UUID.h"
+#include "Engine/Math/Affine2D.h"
 #include "Engine/Renderer/Texture.h"
 #include "Engine/Renderer/SubTexture2D.h"
 #include "Engine/Renderer/Font.h"
+#include "Engine/Renderer/VertexArray.h"
 #include "Engine/Scene/SceneCamera.h"
 #include "Engine/Project/Project.h"
 #include "Engine/Utils/PlatformUtils.h"
@@ -28,6 +30,8 @@ namespace Engine
 
 		IDComponent() = default;
 		IDComponent(const IDComponent&) = default;
+		IDComponent(UUID id)
+			: ID(id) {}
 	};
 
 	struct TagComponent
@@ -65,32 +69,82 @@ namespace Engine
 		TransformComponent(const glm::vec3& position)
 			: Position(position) {}
 
+		// The matrix is cached along with the values it was built from. Reads never write the cache, so
+		// they are safe from several threads: a stale cache is bypassed by building the matrix locally.
+		// RefreshCache, run by the "TransformCache" system, brings it back up to date.
 		glm::mat4 GetTransform() const
 		{
-			glm::mat4 rotation = glm::toMat4(glm::quat(Rotation));
+			return IsCacheValid() ? m_Transform : BuildTransform();
+		}
 
-			return glm::translate(glm::mat4(1.0f), Position)
-				* rotation
-				* glm::scale(glm::mat4(1.0f), Scale);
+		// XY plane of the matrix, rotation about X or Y only shows up as foreshortening
+		Affine2D GetAffine2D() const
+		{
+			return Affine2D::FromMat4(GetTransform());
 		}
 
 		glm::vec3 Up() const
 		{
-			glm::mat4 transform = GetTransform();
-			return {transform[1][0], transform[1][1], transform[1][2]};
+			return GetTransform()[1];
 		}
 
 		glm::vec3 Right() const
 		{
-			glm::mat4 transform = GetTransform();
-			return {transform[0][0], transform[0][1], transform[0][2]};
+			return GetTransform()[0];
 		}
 
 		glm::vec3 Forward() const
 		{
-			glm::mat4 transform = GetTransform();
-			return {transform[2][0], transform[2][0], transform[2][2]};
+			return GetTransform()[2];
+		}
+
+		// A write, only call it where nothing else can read this component
+		void RefreshCache()
+		{
+			if (IsCacheValid())
+				return;
+
+			m_Transform = BuildTransform();
+			m_CachedPosition = Position;
+			m_CachedRotation = Rotation;
+			m_CachedScale = Scale;
+			m_CacheValid = true;
 		}
+	private:
+		bool IsCacheValid() const
+		{
+			return m_CacheValid && Position == m_CachedPosition && Rotation == m_CachedRotation && Scale == m_CachedScale;
+		}
+
+		glm::mat4 BuildTransform() const
+		{
+			// translate * rotate * scale, written out per column instead of multiplying matrices
+			glm::mat4 transform;
+			if (Rotation.x == 0.0f && Rotation.y == 0.0f)
+			{
+				// 2D, rotation about Z only
+				float cosZ = glm::cos(Rotation.z);
+				float sinZ = glm::sin(Rotation.z);
+				transform[0] = glm::vec4(cosZ * Scale.x, sinZ * Scale.x, 0.0f, 0.0f);
+				transform[1] = glm::vec4(-sinZ * Scale.y, cosZ * Scale.y, 0.0f, 0.0f);
+				transform[2] = glm::vec4(0.0f, 0.0f, Scale.z, 0.0f);
+			}
+			else
+			{
+				glm::mat4 rotation = glm::toMat4(glm::quat(Rotation));
+				transform[0] = rotation[0] * Scale.x;
+				transform[1] = rotation[1] * Scale.y;
+				transform[2] = rotation[2] * Scale.z;
+			}
+			transform[3] = glm::vec4(Position, 1.0f);
+			return transform;
+		}
+	private:
+		glm::mat4 m_Transform{ 1.0f };
+		glm::vec3 m_CachedPosition{ 0.0f };
+		glm::vec3 m_CachedRotation{ 0.0f };
+		glm::vec3 m_CachedScale{ 1.0f };
+		bool m_CacheValid = false;
 	};
 
 	struct PrefabComponent
@@ -185,6 +239,181 @@ namespace Engine
 		TextRendererComponent(const TextRendererComponent&) = default;
 	};
 
+	struct TilemapComponent
+	{
+		static const int32_t ChunkSize = 16;
+		static const int32_t EmptyTile = -1;
+
+		struct Chunk
+		{
+			std::array<int32_t, ChunkSize * ChunkSize> Tiles;
+
+			// Runtime cache, rebuilt when dirty
+			bool MeshDirty = true;
+			bool CollidersDirty = true;
+			glm::mat4 MeshTransform{ 0.0f };
+			uint32_t QuadCount = 0;
+			Ref<VertexArray> RuntimeVertexArray = nullptr;
+			Ref<VertexBuffer> RuntimeVertexBuffer = nullptr;
+			void* RuntimeBody = nullptr;
+
+			Chunk() { Tiles.fill(EmptyTile); }
+			Chunk(const Chunk& other)
+				: Tiles(other.Tiles) {} // cache is per scene, so copies rebuild their own
+			Chunk& operator=(const Chunk& other)
+			{
+				Tiles = other.Tiles;
+				MeshDirty = CollidersDirty = true;
+				return *this;
+			}
+			// Moves keep the cache and hand over the body, entt moves components when their pool relocates
+			Chunk(Chunk&& other) noexcept
+				: Tiles(other.Tiles), MeshDirty(other.MeshDirty), CollidersDirty(other.CollidersDirty), MeshTransform(other.MeshTransform), QuadCount(other.QuadCount),
+				RuntimeVertexArray(std::move(other.RuntimeVertexArray)), RuntimeVertexBuffer(std::move(other.RuntimeVertexBuffer)),
+				RuntimeBody(other.RuntimeBody)
+			{
+				other.RuntimeBody = nullptr;
+			}
+			Chunk& operator=(Chunk&& other) noexcept
+			{
+				Tiles = other.Tiles;
+				MeshDirty = other.MeshDirty;
+				CollidersDirty = other.CollidersDirty;
+				MeshTransform = other.MeshTransform;
+				QuadCount = other.QuadCount;
+				RuntimeVertexArray = std::move(other.RuntimeVertexArray);
+				RuntimeVertexBuffer = std::move(other.RuntimeVertexBuffer);
+				RuntimeBody = other.RuntimeBody;
+				other.RuntimeBody = nullptr;
+				return *this;
+			}
+
+			bool IsEmpty() const
+			{
+				for (int32_t tile : Tiles)
+				{
+					if (tile != EmptyTile)
+						return false;
+				}
+				return true;
+			}
+		};
+
+		AssetHandle Tileset = AssetHandle::INVALID();
+		glm::vec2 TilesetCellSize{ 16.0f }; // pixels per tile in the tileset texture
+		glm::vec2 TileSize{ 1.0f }; // world units per tile
+		glm::vec4 Color{ 1.0f };
+
+		bool GenerateColliders = false;
+		float Friction = 0.5f;
+		float Restitution = 0.0f;
+
+		std::unordered_map<uint64_t, Chunk> Chunks;
+
+		TilemapComponent() = default;
+		TilemapComponent(const TilemapComponent&) = default;
+		TilemapComponent& operator=(const TilemapComponent&) = default;
+		// Spelled out so they stay noexcept and pool growth moves chunk bodies instead of copying them away
+		TilemapComponent(TilemapComponent&& other) noexcept
+		{
+			*this = std::move(other);
+		}
+		TilemapComponent& operator=(TilemapComponent&& other) noexcept
+		{
+			Tileset = other.Tileset;
+			TilesetCellSize = other.TilesetCellSize;
+			TileSize = other.TileSize;
+			Color = other.Color;
+			GenerateColliders = other.GenerateColliders;
+			Friction = other.Friction;
+			Restitution = other.Restitution;
+			Chunks = std::move(other.Chunks);
+			return *this;
+		}
+
+		static uint64_t ChunkKey(int32_t chunkX, int32_t chunkY)
+		{
+			return ((uint64_t)(uint32_t)chunkX << 32) | (uint64_t)(uint32_t)chunkY;
+		}
+
+		static glm::ivec2 ChunkCoordsFromKey(uint64_t key)
+		{
+			return { (int32_t)(uint32_t)(key >> 32), (int32_t)(uint32_t)(key & 0xffffffff) };
+		}
+
+		static glm::ivec2 TileToChunkCoords(int32_t x, int32_t y)
+		{
+			// floor division so negative tiles land in negative chunks
+			return { x >= 0 ? x / ChunkSize : (x + 1) / ChunkSize - 1, y >= 0 ? y / ChunkSize : (y + 1) / ChunkSize - 1 };
+		}
+
+		int32_t GetTile(int32_t x, int32_t y) const
+		{
+			glm::ivec2 chunkCoords = TileToChunkCoords(x, y);
+			auto it = Chunks.find(ChunkKey(chunkCoords.x, chunkCoords.y));
+			if (it == Chunks.end())
+				return EmptyTile;
+
+			return it->second.Tiles[(y - chunkCoords.y * ChunkSize) * ChunkSize + (x - chunkCoords.x * ChunkSize)];
+		}
+
+		void SetTile(int32_t x, int32_t y, int32_t tile)
+		{
+			glm::ivec2 chunkCoords = TileToChunkCoords(x, y);
+			uint64_t key = ChunkKey(chunkCoords.x, chunkCoords.y);
+			auto it = Chunks.find(key);
+			if (it == Chunks.end())
+			{
+				if (tile == EmptyTile)
+					return;
+
+				it = Chunks.emplace(key, Chunk()).first;
+			}
+
+			int32_t localX = x - chunkCoords.x * ChunkSize;
+			int32_t localY = y - chunkCoords.y * ChunkSize;
+			int32_t& current = it->second.Tiles[localY * ChunkSize + localX];
+			if (current == tile)
+				return;
+
+			current = tile;
+			it->second.MeshDirty = true;
+			it->second.CollidersDirty = true;
+
+			// edge tiles change the neighbouring chunk's outline
+			if (localX == 0) MarkCollidersDirty(chunkCoords.x - 1, chunkCoords.y);
+			if (localX == ChunkSize - 1) MarkCollidersDirty(chunkCoords.x + 1, chunkCoords.y);
+			if (localY == 0) MarkCollidersDirty(chunkCoords.x, chunkCoords.y - 1);
+			if (localY == ChunkSize - 1) MarkCollidersDirty(chunkCoords.x, chunkCoords.y + 1);
+		}
+
+		void ClearTile(int32_t x, int32_t y)
+		{
+			SetTile(x, y, EmptyTile);
+		}
+
+		void MarkCollidersDirty(int32_t chunkX, int32_t chunkY)
+		{
+			auto it = Chunks.find(ChunkKey(chunkX, chunkY));
+			if (it != Chunks.end())
+				it->second.CollidersDirty = true;
+		}
+
+		void MarkAllDirty()
+		{
+			for (auto& [key, chunk] : Chunks)
+				chunk.MeshDirty = chunk.CollidersDirty = true;
+		}
+
+		const Ref<Texture2D> GetTileset()
+		{
+			if (!AssetManager::IsAssetHandleValid(Tileset))
+				return nullptr;
+
+			return AssetManager::GetAsset<Texture2D>(Tileset);
+		}
+	};
+
 	struct CameraComponent
 	{
 		SceneCamera Camera;
@@ -364,21 +593,21 @@ namespace Engine
 		UIButtonComponent() = default;
 		UIButtonComponent(const UIButtonComponent&) = default;
 
-		void OnPressed()
+		void OnPressed(Scene* scene)
 		{
 			if (ButtonState.Interactable && !ButtonState.Pressed)
 			{
 				ButtonState.Pressed = true;
-				PressedEvent.Interacted();
+				PressedEvent.Interacted(scene);
 			}
 		}
 
-		void OnReleased()
+		void OnReleased(Scene* scene)
 		{
 			if (ButtonState.Interactable && ButtonState.Pressed)
 			{
 				ButtonState.Pressed = false;
-				ReleasedEvent.Interacted();
+				ReleasedEvent.Interacted(scene);
 			}
 		}
 	};
@@ -392,7 +621,7 @@ namespace Engine
 
 	using AllComponents = ComponentGroup<
 		TransformComponent, PrefabComponent, 
-		SpriteRendererComponent, CircleRendererComponent, TextRendererComponent,
+		SpriteRendererComponent, CircleRendererComponent, TextRendererComponent, TilemapComponent,
 		CameraComponent, 
 		NativeScriptComponent, ScriptComponent, 
 		Rigidbody2DComponent, BoxCollider2DComponent, CircleCollider2DComponent,
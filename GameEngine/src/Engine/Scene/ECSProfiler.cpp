@@ -0,0 +1,95 @@
+#include "enginepch.h"
+#include "Engine/Scene/ECSProfiler.h"
+
+#include <entt.hpp>
+
+#include <fstream>
+#include <iomanip>
+
+namespace Engine
+{
+	// Weight of the newest call in the running average
+	static constexpr float s_AverageWeight = 0.05f;
+
+	size_t ECSProfiler::MemoryStatistics::GetTotalBytes() const
+	{
+		size_t bytes = EntityCapacity * sizeof(entt::entity);
+		for (const PoolStatistics& pool : Pools)
+			bytes += pool.Bytes + pool.SparseBytes;
+		return bytes;
+	}
+
+	void ECSProfiler::Record(const char* name, size_t entities, float time)
+	{
+		if (!m_Enabled)
+			return;
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		// Only a handful of views are instrumented, a linear search is fine
+		auto it = std::find_if(m_Views.begin(), m_Views.end(), [name](const ViewStatistics& view) { return view.Name == name; });
+		if (it == m_Views.end())
+		{
+			it = m_Views.insert(m_Views.end(), ViewStatistics());
+			it->Name = name;
+			it->AverageTime = time;
+		}
+
+		it->Entities = (uint32_t)entities;
+		it->Calls++;
+		it->LastTime = time;
+		it->AverageTime += (time - it->AverageTime) * s_AverageWeight;
+		it->MaxTime = std::max(it->MaxTime, time);
+	}
+
+	std::vector<ECSProfiler::ViewStatistics> ECSProfiler::GetViewStats() const
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		return m_Views;
+	}
+
+	void ECSProfiler::ResetViewStats()
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		m_Views.clear();
+	}
+
+	bool ECSProfiler::ExportJSON(const std::filesystem::path& path, const MemoryStatistics& memory, const std::vector<ViewStatistics>& views)
+	{
+		std::ofstream out(path);
+		if (!out.is_open())
+		{
+			ENGINE_CORE_ERROR("Could not open ECS stats file '{0}'", path.string());
+			return false;
+		}
+
+		// Names are type and literal names, nothing needs escaping
+		out << std::setprecision(4) << std::fixed;
+		out << "{\n";
+		out << "  \"entities\": { \"alive\": " << memory.EntitiesAlive << ", \"slots\": " << memory.EntitySlots << ", \"capacity\": " << memory.EntityCapacity << " },\n";
+		out << "  \"totalBytes\": " << memory.GetTotalBytes() << ",\n";
+
+		out << "  \"pools\": [";
+		for (size_t i = 0; i < memory.Pools.size(); ++i)
+		{
+			const PoolStatistics& pool = memory.Pools[i];
+			out << (i == 0 ? "\n" : ",\n");
+			out << "    { \"name\": \"" << pool.Name << "\", \"count\": " << pool.Count << ", \"capacity\": " << pool.Capacity
+				<< ", \"bytes\": " << pool.Bytes << ", \"sparsePages\": " << pool.SparsePages << ", \"sparseBytes\": " << pool.SparseBytes << " }";
+		}
+		out << "\n  ],\n";
+
+		out << "  \"views\": [";
+		for (size_t i = 0; i < views.size(); ++i)
+		{
+			const ViewStatistics& view = views[i];
+			out << (i == 0 ? "\n" : ",\n");
+			out << "    { \"name\": \"" << view.Name << "\", \"entities\": " << view.Entities << ", \"calls\": " << view.Calls
+				<< ", \"lastMs\": " << view.LastTime << ", \"averageMs\": " << view.AverageTime << ", \"maxMs\": " << view.MaxTime << " }";
+		}
+		out << "\n  ]\n";
+		out << "}\n";
+
+		return true;
+	}
+}
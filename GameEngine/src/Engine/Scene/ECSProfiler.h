@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Engine/Core/Timer.h"
+
+#include <mutex>
+
+namespace Engine
+{
+	// Time the engine's systems spend in their view iterations, per scene. Recording is thread safe,
+	// systems may run in parallel. Component pool memory is gathered by Scene::GetECSMemoryStats.
+	class ECSProfiler
+	{
+	public:
+		struct PoolStatistics
+		{
+			std::string Name;
+			size_t Count = 0;
+			size_t Capacity = 0;
+			// Packed component and entity arrays, heap owned by components (strings, vectors) isn't counted
+			size_t Bytes = 0;
+			// entt doesn't expose its sparse arrays, these are the pages the live entries need
+			size_t SparsePages = 0;
+			size_t SparseBytes = 0;
+		};
+
+		struct MemoryStatistics
+		{
+			size_t EntitiesAlive = 0;
+			// Alive plus destroyed identifiers waiting for reuse
+			size_t EntitySlots = 0;
+			size_t EntityCapacity = 0;
+			std::vector<PoolStatistics> Pools;
+
+			size_t GetTotalBytes() const;
+		};
+
+		struct ViewStatistics
+		{
+			std::string Name;
+			// Estimate for multi component views (smallest pool)
+			uint32_t Entities = 0;
+			uint64_t Calls = 0;
+			float LastTime = 0.0f; // ms
+			float AverageTime = 0.0f; // ms
+			float MaxTime = 0.0f; // ms
+		};
+
+		// Times from construction to destruction
+		class ScopedView
+		{
+		public:
+			ScopedView(ECSProfiler& profiler, const char* name, size_t entities)
+				: m_Profiler(profiler), m_Name(name), m_Entities(entities) {}
+			~ScopedView() { m_Profiler.Record(m_Name, m_Entities, m_Timer.ElapsedMillis()); }
+		private:
+			ECSProfiler& m_Profiler;
+			const char* m_Name;
+			size_t m_Entities;
+			Timer m_Timer;
+		};
+
+		void Record(const char* name, size_t entities, float time);
+
+		std::vector<ViewStatistics> GetViewStats() const;
+		void ResetViewStats();
+
+		// Memory and view timings as one JSON object, for tracking trends in CI
+		static bool ExportJSON(const std::filesystem::path& path, const MemoryStatistics& memory, const std::vector<ViewStatistics>& views);
+
+		bool IsEnabled() const { return m_Enabled; }
+		void SetEnabled(bool enabled) { m_Enabled = enabled; }
+	private:
+		mutable std::mutex m_Mutex;
+		std::vector<ViewStatistics> m_Views;
+		bool m_Enabled = true;
+	};
+}
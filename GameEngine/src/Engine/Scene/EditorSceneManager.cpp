@@ -1,5 +1,6 @@
 #include "enginepch.h"
 #include "Engine/Scene/EditorSceneManager.h"
+#include "Engine/Scene/Entity.h"
 #include "Engine/Asset/AssetManager.h"
 
 namespace Engine
@@ -43,6 +44,27 @@ namespace Engine
 		return m_ActiveScene;
 	}
 
+	Ref<SceneLoadOperation> EditorSceneManager::LoadSceneAsync(const AssetHandle handle, SceneLoadMode mode)
+	{
+		Ref<SceneLoadOperation> operation = CreateRef<SceneLoadOperation>(handle, mode);
+
+		if (mode == SceneLoadMode::Single)
+		{
+			LoadScene(handle);
+		}
+		else
+		{
+			auto scene = AssetManager::GetAsset<Scene>(handle);
+			if (scene)
+				operation->m_Entities = m_ActiveScene->MergeScene(scene);
+		}
+
+		operation->m_Scene = m_ActiveScene;
+		operation->m_State = SceneLoadOperation::State::Done;
+		operation->m_Progress = 1.0f;
+		return operation;
+	}
+
 	Ref<Scene> EditorSceneManager::CreateNewScene(const std::string& name)
 	{
 		ActiveSceneRuntimeStop();
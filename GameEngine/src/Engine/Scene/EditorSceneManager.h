@@ -16,6 +16,9 @@ namespace Engine
 
 		Ref<Scene> LoadScene(const AssetHandle handle) override;
 		Ref<Scene> LoadScene(const std::filesystem::path& path);
+		// Editor assets load from disk on demand, so this loads synchronously and returns a finished operation
+		Ref<SceneLoadOperation> LoadSceneAsync(const AssetHandle handle, SceneLoadMode mode = SceneLoadMode::Single) override;
+		void UpdateSceneLoading() override {}
 
 		Ref<Scene> CreateNewScene(const std::string& name = "Untitled") override;
 
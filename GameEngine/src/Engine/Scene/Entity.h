@@ -63,10 +63,18 @@ namespace Engine
 
 		operator bool() const { return m_EntityHandle != entt::null; }
 		operator entt::entity() const { return m_EntityHandle; }
+		Scene* GetScene() const { return m_Scene; }
 		operator uint32_t() const { return (uint32_t)m_EntityHandle; }
 
 		UUID GetUUID() { return GetComponent<IDComponent>().ID; }
 		const std::string& GetName() { return GetComponent<TagComponent>().Tag; }
+		// Keeps the scene's name index in sync, don't assign TagComponent::Tag directly
+		void SetName(const std::string& name)
+		{
+			auto& tag = GetComponent<TagComponent>();
+			m_Scene->m_NameIndex.Rename(m_EntityHandle, tag.Tag, name);
+			tag.Tag = name;
+		}
 
 		glm::mat4 GetWorldSpaceTransform()
 		{
@@ -84,21 +92,25 @@ namespace Engine
 			return localTransform;
 		}
 
+		// Same hierarchy walk as GetWorldSpaceTransform, for the 2D render paths
+		Affine2D GetWorldSpaceAffine2D()
+		{
+			return m_Scene->GetWorldSpaceAffine2D(GetComponent<TransformComponent>(), GetComponent<RelationshipComponent>());
+		}
+
 		glm::mat4 GetUISpaceTransform()
 		{
-			glm::mat4 transform = GetWorldSpaceTransform();
-			if (HasComponent<UILayoutComponent>())
-			{
-				glm::vec3 worldPosition{ 0.0f, 0.0f, 0.0f }, worldRotation{ 0.0f, 0.0f, 0.0f }, worldScale{ 0.0f, 0.0f, 0.0f };
-				Math::DecomposeTransform(transform, worldPosition, worldRotation, worldScale);
+			if (!HasComponent<UILayoutComponent>())
+				return GetWorldSpaceTransform();
 
-				UILayoutComponent ui = GetComponent<UILayoutComponent>();
+			return GetUISpaceAffine2D().ToMat4();
+		}
 
-				glm::vec2 anchored = glm::clamp(ui.AnchorMax + ui.AnchorMin, -1.0f, 1.0f) / glm::vec2(2.0f);
-				anchored *= glm::vec2(m_Scene->m_ViewportWidth, m_Scene->m_ViewportHeight);
-				
-				transform = Math::GenRectTransform(glm::vec3(anchored, 0.0f) + worldPosition + glm::vec3(0.0f, 0.0f, 1.0f), worldRotation.z, glm::vec2(worldScale.x * ui.Size.x, worldScale.y * ui.Size.y));
-			}
+		Affine2D GetUISpaceAffine2D()
+		{
+			Affine2D transform = GetWorldSpaceAffine2D();
+			if (HasComponent<UILayoutComponent>())
+				return m_Scene->GetUISpaceAffine2D(transform, GetComponent<UILayoutComponent>());
 
 			return transform;
 		}
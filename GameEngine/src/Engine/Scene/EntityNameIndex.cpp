@@ -0,0 +1,118 @@
+#include "enginepch.h"
+#include "Engine/Scene/EntityNameIndex.h"
+
+namespace Engine
+{
+	void EntityNameIndex::Add(entt::entity entity, const std::string& name)
+	{
+		auto it = m_Lookup.find(name);
+		if (it != m_Lookup.end())
+		{
+			it->second->push_back(entity);
+			return;
+		}
+
+		auto [node, inserted] = m_Names.emplace(name, std::vector<entt::entity>{ entity });
+		m_Lookup.emplace(node->first, &node->second);
+	}
+
+	void EntityNameIndex::Remove(entt::entity entity, const std::string& name)
+	{
+		auto it = m_Lookup.find(name);
+		if (it == m_Lookup.end())
+			return;
+
+		auto& entities = *it->second;
+		auto entityIt = std::find(entities.begin(), entities.end(), entity);
+		if (entityIt != entities.end())
+			entities.erase(entityIt);
+
+		if (!entities.empty())
+			return;
+
+		// Erase the view before the string it points at
+		m_Lookup.erase(it);
+		m_Names.erase(m_Names.find(name));
+	}
+
+	void EntityNameIndex::Remove(const std::vector<entt::entity>& entities, const std::vector<std::string_view>& names)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		// Each name's list is filtered once instead of an erase per entity
+		std::vector<std::pair<std::vector<entt::entity>*, std::string_view>> lists;
+		lists.reserve(names.size());
+		for (std::string_view name : names)
+		{
+			auto it = m_Lookup.find(name);
+			if (it != m_Lookup.end())
+				lists.emplace_back(it->second, name);
+		}
+
+		std::sort(lists.begin(), lists.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+		lists.erase(std::unique(lists.begin(), lists.end(), [](const auto& a, const auto& b) { return a.first == b.first; }), lists.end());
+
+		for (auto& [named, name] : lists)
+		{
+			named->erase(std::remove_if(named->begin(), named->end(), [&](entt::entity entity)
+			{
+				return std::binary_search(entities.begin(), entities.end(), entity);
+			}), named->end());
+
+			if (!named->empty())
+				continue;
+
+			// Erase the view before the string it points at
+			m_Lookup.erase(name);
+			m_Names.erase(m_Names.find(name));
+		}
+	}
+
+	void EntityNameIndex::Rename(entt::entity entity, const std::string& oldName, const std::string& newName)
+	{
+		if (oldName == newName)
+			return;
+
+		Remove(entity, oldName);
+		Add(entity, newName);
+	}
+
+	void EntityNameIndex::Clear()
+	{
+		m_Lookup.clear();
+		m_Names.clear();
+	}
+
+	entt::entity EntityNameIndex::Find(std::string_view name) const
+	{
+		auto it = m_Lookup.find(name);
+		if (it == m_Lookup.end())
+			return entt::null;
+
+		return it->second->front();
+	}
+
+	const std::vector<entt::entity>& EntityNameIndex::FindAll(std::string_view name) const
+	{
+		static const std::vector<entt::entity> s_None;
+
+		auto it = m_Lookup.find(name);
+		if (it == m_Lookup.end())
+			return s_None;
+
+		return *it->second;
+	}
+
+	void EntityNameIndex::FindWithPrefix(std::string_view prefix, std::vector<entt::entity>& entities) const
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		for (auto it = m_Names.lower_bound(prefix); it != m_Names.end(); ++it)
+		{
+			if (it->first.compare(0, prefix.size(), prefix) != 0)
+				break;
+
+			entities.insert(entities.end(), it->second.begin(), it->second.end());
+		}
+	}
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <entt.hpp>
+
+#include <map>
+#include <string_view>
+
+namespace Engine
+{
+	// Entities by TagComponent name. Each name is stored once, exact lookups go through a hash table
+	// and prefix queries walk the sorted names.
+	class EntityNameIndex
+	{
+	public:
+		EntityNameIndex() = default;
+		EntityNameIndex(const EntityNameIndex&) = delete;
+		EntityNameIndex& operator=(const EntityNameIndex&) = delete;
+
+		void Add(entt::entity entity, const std::string& name);
+		void Remove(entt::entity entity, const std::string& name);
+		// Batch remove, entities must be sorted and names[i] is the current name of entities[i]
+		void Remove(const std::vector<entt::entity>& entities, const std::vector<std::string_view>& names);
+		void Rename(entt::entity entity, const std::string& oldName, const std::string& newName);
+		void Clear();
+
+		// First entity given the name that still has it, entt::null if none
+		entt::entity Find(std::string_view name) const;
+		// In the order the entities got the name
+		const std::vector<entt::entity>& FindAll(std::string_view name) const;
+		void FindWithPrefix(std::string_view prefix, std::vector<entt::entity>& entities) const;
+
+		size_t GetNameCount() const { return m_Names.size(); }
+	private:
+		std::map<std::string, std::vector<entt::entity>, std::less<>> m_Names;
+		// Keys view the strings owned by m_Names, map nodes don't move
+		std::unordered_map<std::string_view, std::vector<entt::entity>*> m_Lookup;
+	};
+}
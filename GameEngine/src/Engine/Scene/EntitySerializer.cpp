@@ -388,6 +388,41 @@ namespace Engine
 			out << YAML::EndMap; // TextRendererComponent
 		}
 
+		if (entity.HasComponent<TilemapComponent>())
+		{
+			out << YAML::Key << "TilemapComponent";
+			out << YAML::BeginMap; // TilemapComponent
+
+			auto& tilemapComponent = entity.GetComponent<TilemapComponent>();
+			out << YAML::Key << "Tileset" << YAML::Value << tilemapComponent.Tileset;
+			out << YAML::Key << "TilesetCellSize" << YAML::Value << tilemapComponent.TilesetCellSize;
+			out << YAML::Key << "TileSize" << YAML::Value << tilemapComponent.TileSize;
+			out << YAML::Key << "Color" << YAML::Value << tilemapComponent.Color;
+			out << YAML::Key << "GenerateColliders" << YAML::Value << tilemapComponent.GenerateColliders;
+			out << YAML::Key << "Friction" << YAML::Value << tilemapComponent.Friction;
+			out << YAML::Key << "Restitution" << YAML::Value << tilemapComponent.Restitution;
+
+			out << YAML::Key << "Chunks" << YAML::Value << YAML::BeginSeq;
+			for (const auto& [key, chunk] : tilemapComponent.Chunks)
+			{
+				if (chunk.IsEmpty())
+					continue;
+
+				glm::ivec2 chunkCoords = TilemapComponent::ChunkCoordsFromKey(key);
+				out << YAML::BeginMap; // Chunk
+				out << YAML::Key << "X" << YAML::Value << chunkCoords.x;
+				out << YAML::Key << "Y" << YAML::Value << chunkCoords.y;
+				out << YAML::Key << "Tiles" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+				for (int32_t tile : chunk.Tiles)
+					out << tile;
+				out << YAML::EndSeq;
+				out << YAML::EndMap; // Chunk
+			}
+			out << YAML::EndSeq;
+
+			out << YAML::EndMap; // TilemapComponent
+		}
+
 		if (entity.HasComponent<ScriptComponent>())
 		{
 			out << YAML::Key << "ScriptComponent";
@@ -667,6 +702,33 @@ namespace Engine
 			textRenderer.LineSpacing = textRendererComponent["LineSpacing"].as<float>();
 		}
 
+		auto tilemapComponent = entityOut["TilemapComponent"];
+		if (tilemapComponent)
+		{
+			auto& tilemap = entity.AddComponent<TilemapComponent>();
+			tilemap.Tileset = tilemapComponent["Tileset"].as<uint64_t>();
+			tilemap.TilesetCellSize = tilemapComponent["TilesetCellSize"].as<glm::vec2>();
+			tilemap.TileSize = tilemapComponent["TileSize"].as<glm::vec2>();
+			tilemap.Color = tilemapComponent["Color"].as<glm::vec4>();
+			tilemap.GenerateColliders = tilemapComponent["GenerateColliders"].as<bool>();
+			tilemap.Friction = tilemapComponent["Friction"].as<float>();
+			tilemap.Restitution = tilemapComponent["Restitution"].as<float>();
+
+			for (auto chunkNode : tilemapComponent["Chunks"])
+			{
+				auto tiles = chunkNode["Tiles"];
+				if (!tiles || tiles.size() != TilemapComponent::ChunkSize * TilemapComponent::ChunkSize)
+				{
+					ENGINE_CORE_WARN("Skipping tilemap chunk with invalid tile count on entity {}", entity.GetName());
+					continue;
+				}
+
+				auto& chunk = tilemap.Chunks[TilemapComponent::ChunkKey(chunkNode["X"].as<int32_t>(), chunkNode["Y"].as<int32_t>())];
+				for (size_t i = 0; i < tiles.size(); ++i)
+					chunk.Tiles[i] = tiles[i].as<int32_t>();
+			}
+		}
+
 		auto scriptComponent = entityOut["ScriptComponent"];
 		if (scriptComponent)
 		{
@@ -4,6 +4,35 @@
 
 namespace Engine
 {
+	template<typename Group>
+	struct PrefabComponentLists;
+
+	template<typename... Component>
+	struct PrefabComponentLists<ComponentGroup<Component...>>
+	{
+		// Per component type: the node it belongs to and the value to copy
+		std::tuple<std::vector<std::pair<uint32_t, Component>>...> Lists;
+	};
+
+	// Prefab hierarchy flattened depth first (root is node 0), so instances can be built with bulk inserts
+	struct PrefabTemplate
+	{
+		struct Node
+		{
+			std::string Name;
+			int32_t Parent = -1;
+			int32_t FirstChild = -1;
+			int32_t NextChild = -1;
+			int32_t PrevChild = -1;
+			uint64_t ChildrenCount = 0;
+		};
+
+		std::vector<Node> Nodes;
+		PrefabComponentLists<AllComponents> Components;
+		// Unique per compiled template, pools of despawned instances only reuse ones built from the same version
+		uint64_t Version = 0;
+	};
+
 	class Prefab : public Asset
 	{
 	public:
@@ -17,9 +46,16 @@ namespace Engine
 
 		static AssetType GetStaticType() { return AssetType::Prefab; }
 		virtual AssetType GetAssetType() const override { return GetStaticType(); }
+
+		const TransformComponent& GetRootTransform() { return m_PrefabEntity.GetComponent<TransformComponent>(); }
 	private:
 		Entity m_PrefabEntity;
 		Ref<Scene> m_PrefabScene;
+		// Compiled by the first instantiate. A prefab doesn't change once loaded: saving or reimporting replaces
+		// the asset with a new Prefab, so the next instantiate compiles a new template with a new version.
+		Scope<PrefabTemplate> m_Template;
+		// Scenes stepped in parallel may instantiate the same prefab
+		std::mutex m_TemplateMutex;
 
 		friend class PrefabSerializer;
 		friend class Scene;
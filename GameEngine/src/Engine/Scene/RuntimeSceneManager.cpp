@@ -1,38 +1,286 @@
 #include "enginepch.h"
 #include "Engine/Scene/RuntimeSceneManager.h"
+#include "Engine/Scene/SceneSerializer.h"
+#include "Engine/Scene/EntitySerializer.h"
 #include "Engine/Asset/AssetManager.h"
+#include "Engine/Asset/TextureImporter.h"
+#include "Engine/Core/JobSystem.h"
+#include "Engine/Core/Timer.h"
 
 namespace Engine
 {
+	struct RuntimeSceneManager::PendingLoad
+	{
+		Ref<SceneLoadOperation> Operation;
+		PakAssetEntry PakEntry;
+
+		// Written by the parse job
+		JobCounter ParseJob;
+		bool Parsed = false;
+		std::string SceneName;
+		std::vector<YAML::Node> EntityNodes;
+		std::vector<PakAssetEntry> Dependencies;
+
+		struct DecodedTexture
+		{
+			AssetHandle Handle;
+			TextureSpecification Spec;
+			Buffer Pixels;
+		};
+
+		// Sized before the decode jobs are kicked, each job writes its own entry
+		JobCounter TextureJobs;
+		std::vector<DecodedTexture> Textures;
+
+		size_t NextDependency = 0;
+		size_t NextTexture = 0;
+		size_t NextEntity = 0;
+		Ref<Scene> SceneAsset;
+	};
+
+	// Assets the scene's components reference, prefab instances included
+	static void CollectDependencies(const YAML::Node& entity, std::vector<AssetHandle>& dependencies)
+	{
+		auto addHandle = [&](const YAML::Node& component, const char* key)
+		{
+			if (component && component[key])
+				dependencies.push_back(component[key].as<uint64_t>());
+		};
+
+		addHandle(entity["SpriteRendererComponent"], "Texture");
+		addHandle(entity["TilemapComponent"], "Tileset");
+		addHandle(entity["AudioSourceComponent"], "Clip");
+		addHandle(entity["PrefabComponent"], "PrefabHandle");
+
+		auto childEntities = entity["ChildEntities"];
+		if (childEntities)
+		{
+			for (auto childEntity : childEntities)
+				CollectDependencies(childEntity, dependencies);
+		}
+	}
 
 	RuntimeSceneManager::RuntimeSceneManager()
 	{
-		for (const auto& [handle, asset] : AssetManager::GetAssetsOfType(AssetType::Scene))
+		// Names come from the pak's table of contents, scenes are imported when they're loaded
+		auto runtimeAssetManager = Project::GetActive()->GetRuntimeAssetManager();
+		for (AssetHandle handle : runtimeAssetManager->GetAssetHandlesOfType(AssetType::Scene))
+			m_SceneMap[handle] = runtimeAssetManager->GetAssetName(handle);
+	}
+
+	Ref<Scene> RuntimeSceneManager::LoadScene(const AssetHandle handle)
+	{
+		ENGINE_CORE_TRACE("Loading Scene: {}", handle);
+		ActivateScene(AssetManager::GetAsset<Scene>(handle), handle);
+		return m_ActiveScene;
+	}
+
+	Ref<SceneLoadOperation> RuntimeSceneManager::LoadSceneAsync(const AssetHandle handle, SceneLoadMode mode)
+	{
+		ENGINE_CORE_TRACE("Loading Scene Async: {}", handle);
+
+		Ref<PendingLoad> load = CreateRef<PendingLoad>();
+		load->Operation = CreateRef<SceneLoadOperation>(handle, mode);
+
+		if (!Project::GetActive()->GetRuntimeAssetManager()->TryGetPakEntry(handle, load->PakEntry) || load->PakEntry.Type != AssetType::Scene)
+		{
+			ENGINE_CORE_ERROR("Scene Asset: {}, Invalid!", handle);
+			load->Operation->m_State = SceneLoadOperation::State::Failed;
+			return load->Operation;
+		}
+
+		if (AssetManager::IsAssetLoaded(handle))
+		{
+			// Nothing to read, activates on the next UpdateSceneLoading
+			load->SceneAsset = AssetManager::GetAsset<Scene>(handle);
+			load->Operation->m_State = SceneLoadOperation::State::Deserializing;
+		}
+		else
+		{
+			JobSystem::Kick([load]()
+			{
+				ENGINE_PROFILE_SCOPE("RuntimeSceneManager::LoadSceneAsync - Parse");
+
+				YAML::Node data;
+				if (!SceneSerializer::TryParseData(load->PakEntry, data))
+					return;
+
+				load->SceneName = data["Scene"].as<std::string>();
+
+				std::vector<AssetHandle> dependencies;
+				auto entities = data["Entities"];
+				if (entities)
+				{
+					for (auto entity : entities)
+					{
+						CollectDependencies(entity, dependencies);
+						load->EntityNodes.push_back(entity);
+					}
+				}
+
+				std::sort(dependencies.begin(), dependencies.end());
+				dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+				auto runtimeAssetManager = Project::GetActive()->GetRuntimeAssetManager();
+				for (AssetHandle dependency : dependencies)
+				{
+					PakAssetEntry pakEntry;
+					if (dependency.IsValid() && runtimeAssetManager->TryGetPakEntry(dependency, pakEntry))
+						load->Dependencies.push_back(pakEntry);
+				}
+
+				load->Parsed = true;
+			}, &load->ParseJob);
+		}
+
+		m_PendingLoads.push_back(load);
+		return load->Operation;
+	}
+
+	void RuntimeSceneManager::UpdateSceneLoading()
+	{
+		ENGINE_PROFILE_FUNCTION();
+		Timer timer;
+
+		while (!m_PendingLoads.empty() && timer.ElapsedMillis() < m_LoadBudget)
+		{
+			Ref<PendingLoad> load = m_PendingLoads.front();
+			if (!AdvanceLoad(load))
+				return;
+
+			if (load->Operation->IsDone())
+				m_PendingLoads.pop_front();
+		}
+	}
+
+	bool RuntimeSceneManager::AdvanceLoad(const Ref<PendingLoad>& load)
+	{
+		SceneLoadOperation& operation = *load->Operation;
+		switch (operation.m_State)
 		{
-			if (asset.get() == nullptr || !asset->Handle.IsValid())
+			case SceneLoadOperation::State::Parsing:
+			{
+				if (!load->ParseJob.IsDone())
+					return false;
+
+				if (!load->Parsed)
+				{
+					ENGINE_CORE_ERROR("Failed to load Scene: {}", operation.m_Handle);
+					operation.m_State = SceneLoadOperation::State::Failed;
+					return true;
+				}
+
+				for (const PakAssetEntry& dependency : load->Dependencies)
+				{
+					if (dependency.Type == AssetType::Texture2D && !AssetManager::IsAssetLoaded(dependency.Handle))
+						load->Textures.push_back({ dependency.Handle });
+				}
+
+				for (size_t i = 0; i < load->Textures.size(); ++i)
+				{
+					JobSystem::Kick([load, i]()
+					{
+						PendingLoad::DecodedTexture& texture = load->Textures[i];
+						PakAssetEntry pakEntry;
+						if (Project::GetActive()->GetRuntimeAssetManager()->TryGetPakEntry(texture.Handle, pakEntry))
+							texture.Pixels = TextureImporter::DecodeTexture2DFromPak(pakEntry, texture.Spec);
+					}, &load->TextureJobs);
+				}
+
+				operation.m_State = SceneLoadOperation::State::LoadingAssets;
+				operation.m_Progress = 0.1f;
+				return true;
+			}
+			case SceneLoadOperation::State::LoadingAssets:
 			{
-				ENGINE_CORE_WARN("Scene Asset: {}, Invalid!", handle);
-				continue;
+				size_t steps = load->Dependencies.size() + load->Textures.size();
+
+				// Anything but textures imports through the asset manager, one per step
+				while (load->NextDependency < load->Dependencies.size())
+				{
+					const PakAssetEntry& dependency = load->Dependencies[load->NextDependency++];
+					if (dependency.Type == AssetType::Texture2D || AssetManager::IsAssetLoaded(dependency.Handle))
+						continue;
+
+					AssetManager::GetAsset<Asset>(dependency.Handle);
+					operation.m_Progress = 0.1f + 0.4f * (load->NextDependency + load->NextTexture) / steps;
+					return true;
+				}
+
+				if (!load->TextureJobs.IsDone())
+					return false;
+
+				if (load->NextTexture < load->Textures.size())
+				{
+					PendingLoad::DecodedTexture& texture = load->Textures[load->NextTexture++];
+					if (texture.Pixels)
+					{
+						// GetAsset may have imported it while the decode ran
+						if (AssetManager::IsAssetLoaded(texture.Handle))
+							texture.Pixels.Release();
+						else
+							Project::GetActive()->GetRuntimeAssetManager()->AddLoadedAsset(TextureImporter::CreateTexture2D(texture.Handle, texture.Spec, texture.Pixels));
+					}
+
+					operation.m_Progress = 0.1f + 0.4f * (load->NextDependency + load->NextTexture) / steps;
+					return true;
+				}
+
+				load->SceneAsset = CreateRef<Scene>();
+				load->SceneAsset->SetSceneName(load->SceneName);
+				operation.m_State = SceneLoadOperation::State::Deserializing;
+				operation.m_Progress = 0.5f;
+				return true;
 			}
+			case SceneLoadOperation::State::Deserializing:
+			{
+				// Entity components reach into the asset and script engines, so root entities are created one per step
+				if (load->NextEntity < load->EntityNodes.size())
+				{
+					Entity entity{ {}, load->SceneAsset.get() };
+					EntitySerializer entitySerializer = EntitySerializer();
+					entitySerializer.Deserialize(load->EntityNodes[load->NextEntity++], entity, load->SceneAsset);
 
-			m_SceneMap[handle] = As<Scene>(asset)->GetSceneName();
+					operation.m_Progress = 0.5f + 0.5f * load->NextEntity / load->EntityNodes.size();
+					return true;
+				}
+
+				if (AssetManager::IsAssetLoaded(operation.m_Handle))
+				{
+					load->SceneAsset = AssetManager::GetAsset<Scene>(operation.m_Handle);
+				}
+				else
+				{
+					load->SceneAsset->Handle = operation.m_Handle;
+					Project::GetActive()->GetRuntimeAssetManager()->AddLoadedAsset(load->SceneAsset);
+				}
+
+				if (operation.m_Mode == SceneLoadMode::Single)
+					ActivateScene(load->SceneAsset, operation.m_Handle);
+				else
+					operation.m_Entities = m_ActiveScene->MergeScene(load->SceneAsset);
+
+				ENGINE_CORE_TRACE("Loaded Scene Async: {}", operation.m_Handle);
+				operation.m_Scene = m_ActiveScene;
+				operation.m_State = SceneLoadOperation::State::Done;
+				operation.m_Progress = 1.0f;
+				return true;
+			}
 		}
+
+		return false;
 	}
 
-	Ref<Scene> RuntimeSceneManager::LoadScene(const AssetHandle handle)
+	void RuntimeSceneManager::ActivateScene(const Ref<Scene>& scene, AssetHandle handle)
 	{
-		ENGINE_CORE_TRACE("Loading Scene: {}", handle);
 		if (m_ActiveScene->Handle.IsValid() && m_ActiveScene->IsRunning())
 			m_ActiveScene->OnRuntimeStop();
 
-		auto scene = AssetManager::GetAsset<Scene>(handle);
 		m_ActiveScene = Scene::Copy(scene);
 		m_ActiveScene->SetSceneName(scene->GetSceneName());
 		m_ActiveScene->Handle = handle;
 
 		m_ActiveScene->OnRuntimeStart();
-
-		return m_ActiveScene;
 	}
 
 	Ref<Scene> RuntimeSceneManager::CreateNewScene(const std::string& name)
@@ -1,6 +1,8 @@
 #pragma once
 #include "Engine/Scene/SceneManagerBase.h"
 
+#include <deque>
+
 namespace Engine
 {
 	class RuntimeSceneManager : public SceneManagerBase
@@ -9,6 +11,14 @@ namespace Engine
 		RuntimeSceneManager();
 
 		Ref<Scene> LoadScene(const AssetHandle handle) override;
+		// Parsing and texture decoding run on workers, asset uploads and entity creation on the main thread within the load budget.
+		// Loads finish in the order they were requested.
+		Ref<SceneLoadOperation> LoadSceneAsync(const AssetHandle handle, SceneLoadMode mode = SceneLoadMode::Single) override;
+		void UpdateSceneLoading() override;
+
+		// Main thread time UpdateSceneLoading may spend per frame, in milliseconds
+		float GetLoadBudget() const { return m_LoadBudget; }
+		void SetLoadBudget(float budget) { m_LoadBudget = budget; }
 
 		Ref<Scene> CreateNewScene(const std::string& name = "Untitled") override;
 
@@ -16,8 +26,18 @@ namespace Engine
 
 		const std::map<AssetHandle, std::string>& GetSceneMap() const override { return m_SceneMap; }
 
+	private:
+		struct PendingLoad;
+
+		// Runs one step of the load, returns false while it's waiting on workers
+		bool AdvanceLoad(const Ref<PendingLoad>& load);
+		void ActivateScene(const Ref<Scene>& scene, AssetHandle handle);
+
 	private:
 		Ref<Scene> m_ActiveScene = CreateRef<Scene>("Untitled");
 		std::map<AssetHandle, std::string> m_SceneMap;
+
+		std::deque<Ref<PendingLoad>> m_PendingLoads;
+		float m_LoadBudget = 2.0f;
 	};
 }
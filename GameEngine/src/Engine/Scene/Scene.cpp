@@ -2,11 +2,16 @@
 #include "Engine/Scene/Scene.h"
 
 #include "Engine/Core/Application.h"
+#include "Engine/Core/JobSystem.h"
+#include "Engine/Core/Timer.h"
 #include "Engine/Scene/Entity.h"
 #include "Engine/Scene/Components.h"
 #include "Engine/Scene/ScriptableEntity.h"
 #include "Engine/Scene/Prefab.h"
+#include "Engine/Scene/SceneCommandBuffer.h"
+#include "Engine/Scene/SceneSnapshot.h"
 #include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Renderer/RenderSnapshot.h"
 #include "Engine/Physics/Physics2D.h"
 #include "Engine/Scripting/ScriptEngine.h"
 #include "Engine/UI/UIEngine.h"
@@ -15,26 +20,94 @@
 
 namespace Engine
 {
+	// Runtime handles belong to the scene that created them, copies have to make their own
+	static void ResetRuntimeState(NativeScriptComponent& component) { component.Instance = nullptr; }
+	static void ResetRuntimeState(Rigidbody2DComponent& component) { component.RuntimeBody = nullptr; }
+	static void ResetRuntimeState(BoxCollider2DComponent& component) { component.RuntimeFixture = nullptr; }
+	static void ResetRuntimeState(CircleCollider2DComponent& component) { component.RuntimeFixture = nullptr; }
+
+	template<typename Component>
+	static constexpr bool HasRuntimeState()
+	{
+		return std::is_same_v<Component, NativeScriptComponent> || std::is_same_v<Component, Rigidbody2DComponent>
+			|| std::is_same_v<Component, BoxCollider2DComponent> || std::is_same_v<Component, CircleCollider2DComponent>;
+	}
+
+	// Sprites, circles and colliders are unit quads scaled by the transform
+	static void GetWorldBounds(const Affine2D& transform, glm::vec2& min, glm::vec2& max)
+	{
+		glm::vec2 center = transform.Translation;
+		glm::vec2 extents = 0.5f * (glm::abs(transform.X) + glm::abs(transform.Y));
+		min = center - extents;
+		max = center + extents;
+	}
+
+	// Both registries share entity identifiers, so whole pools can be copied in one go
 	template<typename... Component>
-	static void CopyComponent(entt::registry& dst, entt::registry& src, const std::unordered_map<UUID, entt::entity>& enttMap)
+	static void CopyComponentPools(entt::registry& dst, const entt::registry& src)
 	{
 		([&]()
 		{
-			auto view = src.view<Component>();
-			for (auto srcEntity : view)
-			{
-				entt::entity dstEntity = enttMap.at(src.get<IDComponent>(srcEntity).ID);
+			size_t count = src.size<Component>();
+			if (count == 0)
+				return;
 
-				auto& srcComponent = src.get<Component>(srcEntity);
-				dst.emplace_or_replace<Component>(dstEntity, srcComponent);
+			const entt::entity* entities = src.data<Component>();
+			const Component* components = src.raw<Component>();
+			dst.insert<Component>(entities, entities + count, components, components + count);
+
+			if constexpr (HasRuntimeState<Component>())
+			{
+				Component* copies = dst.raw<Component>();
+				for (size_t i = 0; i < count; ++i)
+					ResetRuntimeState(copies[i]);
 			}
 		}(), ...);
 	}
 
 	template<typename... Component>
-	static void CopyComponent(ComponentGroup<Component...>, entt::registry& dst, entt::registry& src, const std::unordered_map<UUID, entt::entity>& enttMap)
+	static void CopyComponentPools(ComponentGroup<Component...>, entt::registry& dst, const entt::registry& src)
+	{
+		CopyComponentPools<Component...>(dst, src);
+	}
+
+	// Pools of a different registry, remap gives each source entity its identifier in dst
+	template<typename... Component, typename Remap>
+	static void MergeComponentPools(entt::registry& dst, const entt::registry& src, Remap&& remap)
+	{
+		([&]()
+		{
+			size_t count = src.size<Component>();
+			if (count == 0)
+				return;
+
+			const entt::entity* entities = src.data<Component>();
+			const Component* components = src.raw<Component>();
+			std::vector<entt::entity> targets(count);
+			for (size_t i = 0; i < count; ++i)
+				targets[i] = remap(entities[i]);
+
+			dst.insert<Component>(targets.begin(), targets.end(), components, components + count);
+
+			// Groups may have moved the inserted components around, look them up per entity
+			if constexpr (HasRuntimeState<Component>())
+			{
+				for (entt::entity target : targets)
+					ResetRuntimeState(dst.get<Component>(target));
+			}
+		}(), ...);
+	}
+
+	template<typename... Component, typename Remap>
+	static void MergeComponentPools(ComponentGroup<Component...>, entt::registry& dst, const entt::registry& src, Remap&& remap)
+	{
+		MergeComponentPools<Component...>(dst, src, remap);
+	}
+
+	template<typename... Component, typename Fn>
+	static void ForEachComponentType(ComponentGroup<Component...>, Fn&& function)
 	{
-		CopyComponent<Component...>(dst, src, enttMap);
+		(function((Component*)nullptr), ...);
 	}
 
 	template<typename... Component>
@@ -53,34 +126,104 @@ namespace Engine
 		CopyComponentIfExists<Component...>(dst, src);
 	}
 
+	template<typename... Component>
+	static void CollectPrefabComponents(ComponentGroup<Component...>, PrefabTemplate& prefabTemplate, Entity entity, uint32_t node)
+	{
+		([&]()
+		{
+			if (entity.HasComponent<Component>())
+				std::get<std::vector<std::pair<uint32_t, Component>>>(prefabTemplate.Components.Lists).emplace_back(node, entity.GetComponent<Component>());
+		}(), ...);
+	}
+
+	template<typename... Component, typename Fn>
+	static void ForEachPrefabComponentList(ComponentGroup<Component...>, const PrefabTemplate& prefabTemplate, Fn&& function)
+	{
+		(function(std::get<std::vector<std::pair<uint32_t, Component>>>(prefabTemplate.Components.Lists)), ...);
+	}
+
+	template<typename... Component>
+	static void CollectPoolStatistics(const entt::registry& registry, std::vector<ECSProfiler::PoolStatistics>& pools)
+	{
+		// Matches entt's sparse_set paging
+		constexpr size_t entitiesPerPage = ENTT_PAGE_SIZE / sizeof(entt::entity);
+
+		([&]()
+		{
+			ECSProfiler::PoolStatistics& pool = pools.emplace_back();
+
+			std::string_view typeName = typeid(Component).name();
+			pool.Name = typeName.substr(typeName.find_last_of(':') + 1);
+			pool.Count = registry.size<Component>();
+			pool.Capacity = registry.capacity<Component>();
+			pool.Bytes = pool.Capacity * (sizeof(Component) + sizeof(entt::entity));
+
+			std::vector<size_t> pages;
+			pages.reserve(pool.Count);
+			const entt::entity* entities = registry.data<Component>();
+			for (size_t i = 0; i < pool.Count; ++i)
+				pages.push_back((size_t)entt::to_integral(entt::registry::entity(entities[i])) / entitiesPerPage);
+
+			std::sort(pages.begin(), pages.end());
+			pool.SparsePages = std::unique(pages.begin(), pages.end()) - pages.begin();
+			pool.SparseBytes = pool.SparsePages * ENTT_PAGE_SIZE;
+		}(), ...);
+	}
+
+	template<typename... Component>
+	static void CollectPoolStatistics(ComponentGroup<Component...>, const entt::registry& registry, std::vector<ECSProfiler::PoolStatistics>& pools)
+	{
+		CollectPoolStatistics<Component...>(registry, pools);
+	}
+
+	Scene::Scene()
+		:m_CommandBuffer(CreateScope<SceneCommandBuffer>())
+	{
+		RegisterBuiltinSystems();
+		CreateGroups();
+		m_Registry.on_destroy<TilemapComponent>().connect<&Scene::OnTilemapDestroyed>(*this);
+	}
+
+	Scene::Scene(std::string name)
+		:m_Name(name), m_CommandBuffer(CreateScope<SceneCommandBuffer>())
+	{
+		RegisterBuiltinSystems();
+		CreateGroups();
+		m_Registry.on_destroy<TilemapComponent>().connect<&Scene::OnTilemapDestroyed>(*this);
+	}
+
+	Scene::~Scene() = default;
+
 	Ref<Scene> Scene::Copy(Ref<Scene> other)
 	{
+		ENGINE_PROFILE_FUNCTION();
 		ENGINE_CORE_TRACE("Coping Scene");
+		Timer timer;
+
 		Ref<Scene> newScene = CreateRef<Scene>();
 
 		newScene->m_ViewportWidth = other->m_ViewportWidth;
 		newScene->m_ViewportHeight = other->m_ViewportHeight;
 
 		newScene->m_ScreenCamera = other->m_ScreenCamera;
+		newScene->m_SystemScheduler = other->m_SystemScheduler;
 
 		auto& srcSceneRegistry = other->m_Registry;
-		auto& dstceneRegistry = newScene->m_Registry;
+		auto& dstSceneRegistry = newScene->m_Registry;
 
-		// Create entities in new scene
-		auto idView = srcSceneRegistry.view<IDComponent>();
-		for (auto e : idView)
-		{
-			UUID uuid = srcSceneRegistry.get<IDComponent>(e).ID;
-			const auto& name = srcSceneRegistry.get<TagComponent>(e).Tag;
-			auto& relationship = srcSceneRegistry.get<RelationshipComponent>(e);
-			Entity newEntity = newScene->CreateEntityWithUUID(uuid, name);
-			auto& newRelationship = newEntity.GetComponent<RelationshipComponent>();
-			newRelationship = relationship;
-		}
+		// Same entity identifiers (and free list) as the source, so the UUID map carries over unchanged
+		dstSceneRegistry.assign(srcSceneRegistry.data(), srcSceneRegistry.data() + srcSceneRegistry.size());
+		newScene->m_EntityMap = other->m_EntityMap;
 
-		// Copy Components (Except ID, Tag, and Relationship Components)
-		CopyComponent(AllComponents{}, dstceneRegistry, srcSceneRegistry, newScene->m_EntityMap);
+		CopyComponentPools<IDComponent, TagComponent, RelationshipComponent>(dstSceneRegistry, srcSceneRegistry);
+		CopyComponentPools(AllComponents{}, dstSceneRegistry, srcSceneRegistry);
 
+		const entt::entity* taggedEntities = dstSceneRegistry.data<TagComponent>();
+		const TagComponent* tags = dstSceneRegistry.raw<TagComponent>();
+		for (size_t i = 0; i < dstSceneRegistry.size<TagComponent>(); ++i)
+			newScene->m_NameIndex.Add(taggedEntities[i], tags[i].Tag);
+
+		ENGINE_CORE_TRACE("Copied {0} entities in {1}ms", newScene->m_EntityMap.size(), timer.ElapsedMillis());
 		return newScene;
 	}
 
@@ -96,9 +239,11 @@ namespace Engine
 		entity.AddComponent<IDComponent>(uuid);
 		entity.AddComponent<TransformComponent>();
 		entity.AddComponent<RelationshipComponent>();
-		entity.AddComponent<TagComponent>().Tag = name.empty() ? "Entity" : name;
+		auto& tag = entity.AddComponent<TagComponent>();
+		tag.Tag = name.empty() ? "Entity" : name;
 
 		m_EntityMap[uuid] = entity;
+		m_NameIndex.Add(entity, tag.Tag);
 
 		if (m_IsRunning)
 			ScriptEngine::InstantiateEntity(entity);
@@ -108,38 +253,423 @@ namespace Engine
 
 	Entity Scene::CreateEntityFromPrefab(AssetHandle prefabHandle)
 	{
+		return InstantiatePrefab(prefabHandle, 1, nullptr, false).front();
+	}
+
+	std::vector<Entity> Scene::InstantiatePrefab(AssetHandle prefabHandle, uint32_t count, const TransformComponent* rootTransforms, bool startScripts)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		std::vector<Entity> roots;
+		if (count == 0)
+			return roots;
+
 		Ref<Prefab> prefab = AssetManager::GetAsset<Prefab>(prefabHandle);
+		const PrefabTemplate& prefabTemplate = GetPrefabTemplate(*prefab);
+		const uint32_t nodeCount = (uint32_t)prefabTemplate.Nodes.size();
+		const size_t entityCount = (size_t)count * nodeCount;
+
+		// Despawned instances still own their UUIDs and script instances, hand those out first
+		std::vector<UUID> entityIDs;
+		entityIDs.reserve(entityCount);
+		uint32_t recycled = 0;
+		if (m_IsRunning)
+		{
+			auto pool = m_PrefabPools.find(prefabHandle);
+			if (pool != m_PrefabPools.end() && pool->second.TemplateVersion != prefabTemplate.Version)
+			{
+				// The prefab was saved or reimported, its old instances don't match the new template.
+				// Their script instances are released with the script context.
+				m_PrefabPoolStats.InstancesPooled -= (uint32_t)pool->second.Instances.size();
+				m_PrefabPools.erase(pool);
+				pool = m_PrefabPools.end();
+			}
+
+			if (pool != m_PrefabPools.end())
+			{
+				auto& instances = pool->second.Instances;
+				recycled = std::min(count, (uint32_t)instances.size());
+				for (uint32_t i = 0; i < recycled; ++i)
+				{
+					entityIDs.insert(entityIDs.end(), instances.back().begin(), instances.back().end());
+					instances.pop_back();
+				}
+			}
+		}
+
+		UUID::Generate(entityIDs, entityCount - entityIDs.size());
+
+		// Instances are laid out one after another, each in template node order
+		std::vector<entt::entity> entities(entityCount);
+		m_Registry.create(entities.begin(), entities.end());
+		m_EntityMap.reserve(m_EntityMap.size() + entityCount);
 
-		Entity entity = CopyEntityFromOtherScene(prefab->m_PrefabEntity);
+		std::vector<IDComponent> ids;
+		ids.reserve(entityCount);
+		std::vector<TagComponent> tags(entityCount);
+		std::vector<RelationshipComponent> relationships(entityCount);
+		for (size_t first = 0; first < entityCount; first += nodeCount)
+		{
+			auto nodeID = [&](int32_t node) { return node < 0 ? UUID::INVALID() : entityIDs[first + node]; };
+
+			for (uint32_t node = 0; node < nodeCount; ++node)
+			{
+				const PrefabTemplate::Node& templateNode = prefabTemplate.Nodes[node];
+				size_t index = first + node;
+
+				m_EntityMap[entityIDs[index]] = entities[index];
+				m_NameIndex.Add(entities[index], templateNode.Name);
+				ids.emplace_back(entityIDs[index]);
+				tags[index].Tag = templateNode.Name;
+
+				RelationshipComponent& relationship = relationships[index];
+				relationship.ChildrenCount = templateNode.ChildrenCount;
+				relationship.FirstChild = nodeID(templateNode.FirstChild);
+				relationship.NextChild = nodeID(templateNode.NextChild);
+				relationship.PrevChild = nodeID(templateNode.PrevChild);
+				relationship.Parent = nodeID(templateNode.Parent);
+			}
+		}
+
+		m_Registry.insert<IDComponent>(entities.begin(), entities.end(), ids.begin(), ids.end());
+		m_Registry.insert<TagComponent>(entities.begin(), entities.end(), tags.begin(), tags.end());
+		m_Registry.insert<RelationshipComponent>(entities.begin(), entities.end(), relationships.begin(), relationships.end());
+
+		ForEachPrefabComponentList(AllComponents{}, prefabTemplate, [&](const auto& list)
+		{
+			using Component = typename std::decay_t<decltype(list)>::value_type::second_type;
+			if (list.empty())
+				return;
+
+			std::vector<entt::entity> targets;
+			std::vector<Component> values;
+			targets.reserve(list.size() * count);
+			values.reserve(list.size() * count);
+			for (size_t first = 0; first < entityCount; first += nodeCount)
+			{
+				for (const auto& [node, value] : list)
+				{
+					targets.push_back(entities[first + node]);
+					values.push_back(value);
+				}
+			}
+
+			m_Registry.insert<Component>(targets.begin(), targets.end(), values.begin(), values.end());
+		});
+
+		if (rootTransforms)
+		{
+			for (uint32_t instance = 0; instance < count; ++instance)
+				m_Registry.get<TransformComponent>(entities[(size_t)instance * nodeCount]) = rootTransforms[instance];
+		}
+
+		// Same hooks AddComponent runs (physics bodies, camera viewport, audio autoplay), once everything is in place
+		ForEachPrefabComponentList(AllComponents{}, prefabTemplate, [&](const auto& list)
+		{
+			using Component = typename std::decay_t<decltype(list)>::value_type::second_type;
+			for (size_t first = 0; first < entityCount; first += nodeCount)
+			{
+				for (const auto& [node, value] : list)
+				{
+					entt::entity e = entities[first + node];
+					OnComponentAdded<Component>(Entity{ e, this }, m_Registry.get<Component>(e));
+				}
+			}
+		});
 
 		if (m_IsRunning)
-			ScriptEngine::InstantiateEntity(entity);
+		{
+			for (size_t i = (size_t)recycled * nodeCount; i < entityCount; ++i)
+				ScriptEngine::InstantiateEntity({ entities[i], this });
+		}
 
-		return entity;
+		if (m_IsRunning && startScripts)
+		{
+			const auto& scripts = std::get<std::vector<std::pair<uint32_t, ScriptComponent>>>(prefabTemplate.Components.Lists);
+			for (size_t first = 0; first < entityCount; first += nodeCount)
+			{
+				for (const auto& [node, value] : scripts)
+					ScriptEngine::OnCreateEntity({ entities[first + node], this }, m_Registry.get<ScriptComponent>(entities[first + node]));
+			}
+
+			for (size_t first = 0; first < entityCount; first += nodeCount)
+			{
+				for (const auto& [node, value] : scripts)
+					ScriptEngine::OnStartEntity({ entities[first + node], this }, m_Registry.get<ScriptComponent>(entities[first + node]));
+			}
+		}
+
+		roots.reserve(count);
+		for (size_t first = 0; first < entityCount; first += nodeCount)
+			roots.emplace_back(entities[first], this);
+
+		m_PrefabPoolStats.InstancesSpawned += count;
+		m_PrefabPoolStats.InstancesRecycled += recycled;
+		m_PrefabPoolStats.InstancesPooled -= recycled;
+
+		return roots;
+	}
+
+	void Scene::DespawnPrefabInstance(Entity root)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		AssetHandle prefabHandle = root.HasComponent<PrefabComponent>() ? root.GetComponent<PrefabComponent>().PrefabHandle : AssetHandle::INVALID();
+		if (!m_IsRunning || !prefabHandle.IsValid())
+		{
+			DestroyEntity(root);
+			return;
+		}
+
+		// Gather in the order the template was compiled in, with each entity's parent index
+		std::vector<Entity> instance;
+		std::vector<int32_t> parents;
+		std::function<void(Entity, int32_t)> gather = [&](Entity entity, int32_t parent)
+		{
+			int32_t node = (int32_t)instance.size();
+			instance.push_back(entity);
+			parents.push_back(parent);
+			for (Entity child : entity.Children())
+				gather(child, node);
+		};
+		gather(root, -1);
+
+		// Pooled UUIDs keep their script instances and are handed out by node index, so the instance has to
+		// still line up with the template node for node. Children added, moved, reordered or renamed at runtime
+		// break that, those instances are destroyed instead.
+		const PrefabTemplate& prefabTemplate = GetPrefabTemplate(*AssetManager::GetAsset<Prefab>(prefabHandle));
+		bool matchesTemplate = instance.size() == prefabTemplate.Nodes.size();
+		for (size_t node = 0; node < instance.size() && matchesTemplate; ++node)
+		{
+			const PrefabTemplate::Node& templateNode = prefabTemplate.Nodes[node];
+			matchesTemplate = parents[node] == templateNode.Parent && instance[node].GetName() == templateNode.Name;
+		}
+
+		if (matchesTemplate)
+		{
+			const auto& scripts = std::get<std::vector<std::pair<uint32_t, ScriptComponent>>>(prefabTemplate.Components.Lists);
+			size_t scriptCount = 0;
+			for (Entity entity : instance)
+			{
+				if (entity.HasComponent<ScriptComponent>())
+					scriptCount++;
+			}
+
+			matchesTemplate = scriptCount == scripts.size();
+			for (const auto& [node, script] : scripts)
+			{
+				if (!matchesTemplate)
+					break;
+
+				Entity entity = instance[node];
+				matchesTemplate = entity.HasComponent<ScriptComponent>() && entity.GetComponent<ScriptComponent>().ClassName == script.ClassName;
+			}
+		}
+
+		if (!matchesTemplate)
+		{
+			DestroyEntity(root);
+			return;
+		}
+
+		if (root.GetComponent<RelationshipComponent>().Parent.IsValid())
+			root.GetParent().RemoveChild(root);
+
+		for (Entity entity : instance)
+		{
+			if (entity.HasComponent<ScriptComponent>())
+				ScriptEngine::OnDespawnEntity(entity, entity.GetComponent<ScriptComponent>());
+		}
+
+		std::vector<UUID> entityIDs;
+		std::vector<entt::entity> entities;
+		entityIDs.reserve(instance.size());
+		entities.reserve(instance.size());
+		for (Entity entity : instance)
+		{
+			entityIDs.push_back(entity.GetUUID());
+			entities.push_back(entity);
+			m_EntityMap.erase(entity.GetUUID());
+			m_NameIndex.Remove(entity, entity.GetName());
+			m_SpatialIndex.Remove(entity);
+		}
+
+		Physics2DEngine::DestroyBodies(this, entities);
+		AudioEngine::ReleaseSources(entityIDs);
+		m_Registry.destroy(entities.begin(), entities.end());
+
+		PrefabPool& pool = m_PrefabPools[prefabHandle];
+		if (pool.TemplateVersion != prefabTemplate.Version)
+		{
+			m_PrefabPoolStats.InstancesPooled -= (uint32_t)pool.Instances.size();
+			pool.Instances.clear();
+			pool.TemplateVersion = prefabTemplate.Version;
+		}
+		pool.Instances.push_back(std::move(entityIDs));
+
+		m_PrefabPoolStats.InstancesDespawned++;
+		m_PrefabPoolStats.InstancesPooled++;
 	}
 
 	void Scene::DestroyEntity(Entity entity)
 	{
+		DestroyEntities(&entity, 1);
+	}
+
+	void Scene::DestroyEntities(const std::vector<Entity>& entities)
+	{
+		DestroyEntities(entities.data(), entities.size());
+	}
+
+	void Scene::DestroyEntities(const Entity* entities, size_t count)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (count == 0)
+			return;
+
+		// Gather every subtree by walking the sibling lists, nothing below a root needs unlinking
+		std::vector<entt::entity> destroyed;
+		destroyed.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+			destroyed.push_back(entities[i]);
+
+		for (size_t i = 0; i < destroyed.size(); ++i)
+		{
+			const auto& relationship = m_Registry.get<RelationshipComponent>(destroyed[i]);
+			UUID childID = relationship.FirstChild;
+			for (uint64_t child = 0; child < relationship.ChildrenCount && childID.IsValid(); ++child)
+			{
+				entt::entity childHandle = m_EntityMap.at(childID);
+				destroyed.push_back(childHandle);
+				childID = m_Registry.get<RelationshipComponent>(childHandle).NextChild;
+			}
+		}
+
+		// An entity passed along with one of its ancestors was gathered twice
+		std::sort(destroyed.begin(), destroyed.end());
+		destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
+
+		// Only roots whose parent survives are unlinked
+		for (size_t i = 0; i < count; ++i)
+		{
+			Entity entity = entities[i];
+			UUID parentID = entity.GetComponent<RelationshipComponent>().Parent;
+			if (parentID.IsValid() && !std::binary_search(destroyed.begin(), destroyed.end(), m_EntityMap.at(parentID)))
+				entity.GetParent().RemoveChild(entity);
+		}
+
+		std::vector<UUID> entityIDs;
+		std::vector<std::string_view> names;
+		entityIDs.reserve(destroyed.size());
+		names.reserve(destroyed.size());
+		for (entt::entity e : destroyed)
+		{
+			entityIDs.push_back(m_Registry.get<IDComponent>(e).ID);
+			names.push_back(m_Registry.get<TagComponent>(e).Tag);
+			m_SpatialIndex.Remove(e);
+		}
+
 		if (m_IsRunning)
 		{
-			Physics2DEngine::DestroyBody(entity);
-			AudioEngine::StopSound(entity.GetUUID());
+			Physics2DEngine::DestroyBodies(this, destroyed);
+			AudioEngine::ReleaseSources(entityIDs);
+		}
+
+		for (UUID entityID : entityIDs)
+			m_EntityMap.erase(entityID);
+		m_NameIndex.Remove(destroyed, names);
+		m_Registry.destroy(destroyed.begin(), destroyed.end());
+	}
+
+	std::vector<Entity> Scene::MergeScene(const Ref<Scene>& other)
+	{
+		ENGINE_PROFILE_FUNCTION();
+		Timer timer;
+
+		std::vector<Entity> roots;
+		const entt::registry& srcRegistry = other->m_Registry;
+		const size_t count = srcRegistry.size<IDComponent>();
+		const entt::entity* srcEntities = srcRegistry.data<IDComponent>();
+		const IDComponent* srcIDs = srcRegistry.raw<IDComponent>();
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (m_EntityMap.contains(srcIDs[i].ID))
+			{
+				ENGINE_CORE_ERROR("Could not merge Scene {0} into {1}, Entity {2} already exists", other->m_Name, m_Name, srcIDs[i].ID);
+				return roots;
+			}
 		}
 
-		if (entity.GetComponent<RelationshipComponent>().Parent.IsValid())
+		std::vector<entt::entity> entities(count);
+		m_Registry.create(entities.begin(), entities.end());
+		m_EntityMap.reserve(m_EntityMap.size() + count);
+
+		// Indexed by the source entity's identifier, without its version
+		std::vector<entt::entity> remap(srcRegistry.size(), entt::entity{ entt::null });
+		for (size_t i = 0; i < count; ++i)
 		{
-			Entity parent = entity.GetParent();
-			parent.RemoveChild(entity);
+			remap[entt::to_integral(srcRegistry.entity(srcEntities[i]))] = entities[i];
+			m_EntityMap[srcIDs[i].ID] = entities[i];
 		}
 
-		for (auto& child : entity.Children())
+		auto remapEntity = [&](entt::entity e) { return remap[entt::to_integral(srcRegistry.entity(e))]; };
+		MergeComponentPools<IDComponent, TagComponent, RelationshipComponent>(m_Registry, srcRegistry, remapEntity);
+		MergeComponentPools(AllComponents{}, m_Registry, srcRegistry, remapEntity);
+
+		const entt::entity* taggedEntities = srcRegistry.data<TagComponent>();
+		const TagComponent* tags = srcRegistry.raw<TagComponent>();
+		for (size_t i = 0; i < srcRegistry.size<TagComponent>(); ++i)
+			m_NameIndex.Add(remapEntity(taggedEntities[i]), tags[i].Tag);
+
+		// Same hooks AddComponent runs, in AllComponents order so bodies exist before their colliders
+		ForEachComponentType(AllComponents{}, [&](auto* type)
 		{
-			entity.RemoveChild(child);
-			DestroyEntity(child);
+			using Component = std::remove_pointer_t<decltype(type)>;
+			const entt::entity* componentEntities = srcRegistry.data<Component>();
+			for (size_t i = 0; i < srcRegistry.size<Component>(); ++i)
+			{
+				entt::entity e = remapEntity(componentEntities[i]);
+				OnComponentAdded<Component>(Entity{ e, this }, m_Registry.get<Component>(e));
+			}
+		});
+
+		if (m_IsRunning)
+		{
+			for (entt::entity e : entities)
+				ScriptEngine::InstantiateEntity({ e, this });
+
+			std::vector<entt::entity> scripted;
+			for (entt::entity e : entities)
+			{
+				if (m_Registry.has<ScriptComponent>(e))
+					scripted.push_back(e);
+			}
+
+			for (entt::entity e : scripted)
+				ScriptEngine::OnCreateEntity({ e, this }, m_Registry.get<ScriptComponent>(e));
+
+			for (entt::entity e : scripted)
+				ScriptEngine::OnStartEntity({ e, this }, m_Registry.get<ScriptComponent>(e));
+		}
+
+		for (entt::entity e : entities)
+		{
+			if (!m_Registry.get<RelationshipComponent>(e).Parent.IsValid())
+				roots.emplace_back(e, this);
 		}
 
-		m_EntityMap.erase(entity.GetUUID());
-		m_Registry.destroy(entity);
+		ENGINE_CORE_TRACE("Merged {0} entities from Scene {1} in {2}ms", count, other->m_Name, timer.ElapsedMillis());
+		return roots;
+	}
+
+	void Scene::SetSnapshotsEnabled(bool enabled)
+	{
+		if (!enabled)
+			m_SnapshotBuffer.reset();
+		else if (!m_SnapshotBuffer)
+			m_SnapshotBuffer = CreateScope<SceneSnapshotBuffer>();
 	}
 
 	void Scene::OnViewportResize(uint32_t width, uint32_t height)
@@ -207,6 +737,37 @@ namespace Engine
 		return newEntity;
 	}
 
+	std::vector<Entity> Scene::FindEntitiesInRegion(const glm::vec2& min, const glm::vec2& max)
+	{
+		std::vector<entt::entity> found;
+		m_SpatialIndex.QueryRegion(min, max, found);
+
+		std::vector<Entity> entities;
+		entities.reserve(found.size());
+		for (entt::entity e : found)
+			entities.emplace_back(e, this);
+
+		return entities;
+	}
+
+	std::vector<Entity> Scene::FindEntitiesAtPoint(const glm::vec2& point)
+	{
+		return FindEntitiesInRegion(point, point);
+	}
+
+	std::vector<Entity> Scene::FindEntitiesInRadius(const glm::vec2& center, float radius)
+	{
+		std::vector<entt::entity> found;
+		m_SpatialIndex.QueryRadius(center, radius, found);
+
+		std::vector<Entity> entities;
+		entities.reserve(found.size());
+		for (entt::entity e : found)
+			entities.emplace_back(e, this);
+
+		return entities;
+	}
+
 	bool Scene::DoesEntityExist(UUID uuid)
 	{
 		return m_EntityMap.find(uuid) != m_EntityMap.end();
@@ -225,15 +786,55 @@ namespace Engine
 
 	Entity Scene::FindEntityByName(const std::string_view& entityName)
 	{
-		auto view = m_Registry.view<TagComponent>();
-		for (auto e : view)
-		{
-			const TagComponent& tc = view.get<TagComponent>(e);
-			if (tc.Tag == entityName)
-				return Entity{ e, this };
-		}
+		entt::entity e = m_NameIndex.Find(entityName);
+		if (e == entt::null)
+			return {};
 
-		return {};
+		return Entity{ e, this };
+	}
+
+	std::vector<Entity> Scene::FindEntitiesByName(const std::string_view& entityName)
+	{
+		const auto& found = m_NameIndex.FindAll(entityName);
+
+		std::vector<Entity> entities;
+		entities.reserve(found.size());
+		for (entt::entity e : found)
+			entities.emplace_back(e, this);
+
+		return entities;
+	}
+
+	std::vector<Entity> Scene::FindEntitiesWithNamePrefix(const std::string_view& prefix)
+	{
+		std::vector<entt::entity> found;
+		m_NameIndex.FindWithPrefix(prefix, found);
+
+		std::vector<Entity> entities;
+		entities.reserve(found.size());
+		for (entt::entity e : found)
+			entities.emplace_back(e, this);
+
+		return entities;
+	}
+
+	ECSProfiler::MemoryStatistics Scene::GetECSMemoryStats() const
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		ECSProfiler::MemoryStatistics stats;
+		stats.EntitiesAlive = m_Registry.alive();
+		stats.EntitySlots = m_Registry.size();
+		stats.EntityCapacity = m_Registry.capacity();
+
+		CollectPoolStatistics<IDComponent, TagComponent, RelationshipComponent>(m_Registry, stats.Pools);
+		CollectPoolStatistics(AllComponents{}, m_Registry, stats.Pools);
+		return stats;
+	}
+
+	bool Scene::ExportECSStats(const std::filesystem::path& path) const
+	{
+		return ECSProfiler::ExportJSON(path, GetECSMemoryStats(), m_ECSProfiler.GetViewStats());
 	}
 
 	Entity Scene::CopyEntityFromOtherScene(Entity otherEntity)
@@ -274,6 +875,9 @@ namespace Engine
 		// Create Physics Objects
 		OnPhysics2DStart();
 
+		// Scripts may query positions from OnCreate
+		OnSpatialIndexUpdate();
+
 		// Create Scripts
 		OnScriptsCreate();
 
@@ -289,12 +893,14 @@ namespace Engine
 				AudioEngine::PlaySound(entity.GetUUID(), source.Clip, source.Params);
 			}
 		});
+		m_CommandBuffer->Playback(*this);
 	}
 
 	void Scene::OnSimulationStart()
 	{
 		ENGINE_CORE_TRACE("Scene Simulation Start: {}", Handle);
 		OnPhysics2DStart();
+		OnSpatialIndexUpdate();
 	}
 
 	void Scene::OnRuntimeStop()
@@ -317,6 +923,11 @@ namespace Engine
 			Entity entity = { e, this };
 			AudioEngine::StopSound(entity.GetUUID());
 		});
+		m_CommandBuffer->Clear();
+		ClearPrefabPools();
+
+		ScriptEngine::OnRuntimeStop(this);
+		m_ScriptContext.reset();
 	}
 
 	void Scene::OnSimulationStop()
@@ -327,20 +938,7 @@ namespace Engine
 
 	void Scene::OnUpdateRuntime(Timestep ts)
 	{
-		if (!m_IsPaused || m_StepFrames-- > 0)
-		{
-			// Update UI
-			OnUIUpdate(ts);
-
-			// Update scripts
-			OnScriptsUpdate(ts);
-
-			// Physics
-			OnPhysics2DUpdate(ts);
-
-			// Late Update scripts
-			OnScriptsLateUpdate(ts);
-		}
+		SimulateRuntime(ts);
 
 		// Render 2D
 		Camera* mainCamera = nullptr;
@@ -381,10 +979,46 @@ namespace Engine
 		AudioEngine::PausePlayback(m_IsPaused);
 	}
 
+	void Scene::SimulateRuntime(Timestep ts)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (!m_IsPaused || m_StepFrames-- > 0)
+		{
+			m_SystemScheduler.Run(*this, m_Registry, ts);
+
+			// Sync point for structural changes recorded by scripts, physics callbacks and systems.
+			// Playback and snapshots can call into scripts, which only run on the main thread.
+			auto syncPoint = [this, ts]()
+			{
+				m_CommandBuffer->Playback(*this);
+
+				if (m_SnapshotBuffer)
+					m_SnapshotBuffer->OnUpdate(*this, ts);
+			};
+
+			if (JobSystem::IsMainThread())
+			{
+				syncPoint();
+			}
+			else
+			{
+				JobCounter counter;
+				JobSystem::Kick(syncPoint, &counter, JobAffinity::MainThread);
+				JobSystem::Wait(counter);
+			}
+		}
+	}
+
 	void Scene::OnUpdateSimulation(Timestep ts, EditorCamera& camera)
 	{
 		if (!m_IsPaused || m_StepFrames-- > 0)
+		{
 			OnPhysics2DUpdate(ts);
+			Physics2DEngine::ApplySmoothing(this);
+			OnTransformCacheUpdate();
+			OnSpatialIndexUpdate();
+		}
 
 		Renderer2D::BeginScene(camera);
 
@@ -401,6 +1035,8 @@ namespace Engine
 
 	void Scene::OnUpdateEditor(Timestep ts, EditorCamera& camera)
 	{
+		OnTransformCacheUpdate();
+
 		Renderer2D::BeginScene(camera);
 
 		OnRender2DUpdate();
@@ -414,18 +1050,148 @@ namespace Engine
 		Renderer2D::EndScene();
 	}
 
+	void Scene::RegisterBuiltinSystems()
+	{
+		// UI callbacks, scripts and physics contacts all call into Mono, keep them serial on the main thread
+		m_SystemScheduler.AddSystem("UI", [](Scene& scene, Timestep ts) { scene.OnUIUpdate(ts); }).RunExclusive().RunOnMainThread();
+		m_SystemScheduler.AddSystem("Scripts", [](Scene& scene, Timestep ts) { scene.OnScriptsUpdate(ts); }).RunExclusive().RunOnMainThread();
+		m_SystemScheduler.AddSystem("Physics2D", [](Scene& scene, Timestep ts) { scene.OnPhysics2DUpdate(ts); }).RunExclusive().RunOnMainThread();
+		// The rest is plain component work and runs on workers. Between the exclusive systems above it has nothing
+		// to overlap with, and the later ones chain on TransformComponent: only user systems that don't touch
+		// transforms run alongside them. Stepping several scenes is where the parallelism is.
+		m_SystemScheduler.AddSystem("Physics2DSmoothing", [](Scene& scene, Timestep ts) { Physics2DEngine::ApplySmoothing(&scene); })
+			.Read<Rigidbody2DComponent>().Write<TransformComponent>();
+		m_SystemScheduler.AddSystem("LateScripts", [](Scene& scene, Timestep ts) { scene.OnScriptsLateUpdate(ts); }).RunExclusive().RunOnMainThread();
+		// Transform reads don't write the matrix cache, this refreshes it once everything has moved
+		m_SystemScheduler.AddSystem("TransformCache", [](Scene& scene, Timestep ts) { scene.OnTransformCacheUpdate(); }).Write<TransformComponent>();
+		m_SystemScheduler.AddSystem("SpatialIndex", [](Scene& scene, Timestep ts) { scene.OnSpatialIndexUpdate(); })
+			.Read<TransformComponent, RelationshipComponent, UILayoutComponent>().Write<SpatialIndexAccess>();
+	}
+
+	void Scene::CreateGroups()
+	{
+		// Owning groups keep the owned pools sorted so the hot loops walk packed arrays, created before any
+		// entities so the pools never need rearranging. Only one group may own a type: sprites and circles
+		// in world space are owned, the UI combinations are non-owning groups over the same pools.
+		m_Registry.group<SpriteRendererComponent>(entt::get<TransformComponent, RelationshipComponent>, entt::exclude<UILayoutComponent>);
+		m_Registry.group<CircleRendererComponent>(entt::get<TransformComponent, RelationshipComponent>, entt::exclude<UILayoutComponent>);
+		m_Registry.group<Rigidbody2DComponent>(entt::get<TransformComponent>);
+		m_Registry.group<>(entt::get<UILayoutComponent, SpriteRendererComponent, TransformComponent, RelationshipComponent>);
+		m_Registry.group<>(entt::get<UILayoutComponent, CircleRendererComponent, TransformComponent, RelationshipComponent>);
+	}
+
+	Affine2D Scene::GetWorldSpaceAffine2D(const TransformComponent& transform, const RelationshipComponent& relationship)
+	{
+		Affine2D worldTransform = transform.GetAffine2D();
+
+		UUID parentID = relationship.Parent;
+		while (parentID.IsValid())
+		{
+			ENGINE_CORE_ASSERT(DoesEntityExist(parentID), "Could not find parent Entity with UUID: " + std::to_string(parentID) + " in Scene: " + m_Name);
+			entt::entity parent = m_EntityMap.at(parentID);
+			worldTransform = m_Registry.get<TransformComponent>(parent).GetAffine2D() * worldTransform;
+			parentID = m_Registry.get<RelationshipComponent>(parent).Parent;
+		}
+
+		return worldTransform;
+	}
+
+	Affine2D Scene::GetUISpaceAffine2D(const Affine2D& worldTransform, const UILayoutComponent& layout) const
+	{
+		glm::vec2 anchored = glm::clamp(layout.AnchorMax + layout.AnchorMin, -1.0f, 1.0f) / glm::vec2(2.0f);
+		anchored *= glm::vec2(m_ViewportWidth, m_ViewportHeight);
+
+		// Rotation and scale stay in the columns, sizing them replaces decomposing and rebuilding
+		Affine2D transform = worldTransform;
+		transform.X *= layout.Size.x;
+		transform.Y *= layout.Size.y;
+		transform.Translation += anchored;
+		transform.Depth += 1.0f;
+		return transform;
+	}
+
+	const PrefabTemplate& Scene::GetPrefabTemplate(Prefab& prefab)
+	{
+		std::scoped_lock<std::mutex> lock(prefab.m_TemplateMutex);
+
+		if (prefab.m_Template)
+			return *prefab.m_Template;
+
+		ENGINE_PROFILE_FUNCTION();
+
+		static std::atomic<uint64_t> s_NextTemplateVersion{ 1 };
+
+		prefab.m_Template = CreateScope<PrefabTemplate>();
+		PrefabTemplate& prefabTemplate = *prefab.m_Template;
+		prefabTemplate.Version = s_NextTemplateVersion++;
+
+		std::function<int32_t(Entity, int32_t)> compile = [&](Entity entity, int32_t parent)
+		{
+			int32_t node = (int32_t)prefabTemplate.Nodes.size();
+			PrefabTemplate::Node& templateNode = prefabTemplate.Nodes.emplace_back();
+			templateNode.Name = entity.GetName();
+			templateNode.Parent = parent;
+			CollectPrefabComponents(AllComponents{}, prefabTemplate, entity, node);
+
+			int32_t previous = -1;
+			for (Entity child : entity.Children())
+			{
+				int32_t childNode = compile(child, node);
+
+				auto& nodes = prefabTemplate.Nodes;
+				nodes[childNode].PrevChild = previous;
+				if (previous < 0)
+					nodes[node].FirstChild = childNode;
+				else
+					nodes[previous].NextChild = childNode;
+				nodes[node].ChildrenCount++;
+
+				previous = childNode;
+			}
+
+			return node;
+		};
+		compile(prefab.m_PrefabEntity, -1);
+
+		// Prefabs saved before their root got a PrefabComponent still need one to find their way back to the pool
+		auto& prefabComponents = std::get<std::vector<std::pair<uint32_t, PrefabComponent>>>(prefabTemplate.Components.Lists);
+		if (prefabComponents.empty() || prefabComponents.front().first != 0)
+		{
+			PrefabComponent rootComponent;
+			rootComponent.PrefabHandle = prefab.Handle;
+			prefabComponents.insert(prefabComponents.begin(), { 0, rootComponent });
+		}
+
+		return prefabTemplate;
+	}
+
+	void Scene::ClearPrefabPools()
+	{
+		// Pooled script instances are released with the rest of the script context
+		m_PrefabPools.clear();
+		m_PrefabPoolStats.InstancesPooled = 0;
+	}
+
 	void Scene::OnUIStart()
 	{
-		UIEngine::OnUIStart();
+		m_UIContext = CreateScope<UIContext>();
+	}
+
+	void Scene::OnTilemapDestroyed(entt::registry& registry, entt::entity entity)
+	{
+		Physics2DEngine::DestroyTilemapBodies(this, registry.get<TilemapComponent>(entity));
 	}
 
 	void Scene::OnPhysics2DStart()
 	{
-		Physics2DEngine::OnPhysicsStart();
+		m_Physics2DContext = CreateScope<Physics2DContext>(this);
+		Physics2DEngine::OnPhysicsStart(this);
 	}
 
 	void Scene::OnScriptsCreate()
 	{
+		m_ScriptContext = CreateScope<ScriptContext>();
+
 		for (const auto& [handle, metadata] : AssetManager::GetAssetsOfType(AssetType::Prefab))
 			ScriptEngine::InstantiateAsset(handle);  // TODO remove once all asset types can work
 
@@ -457,12 +1223,13 @@ namespace Engine
 
 	void Scene::OnUIStop()
 	{
-		UIEngine::OnUIStop();
+		m_UIContext.reset();
 	}
 
 	void Scene::OnPhysics2DStop()
 	{
-		Physics2DEngine::OnPhysicsStop();
+		Physics2DEngine::OnPhysicsStop(this);
+		m_Physics2DContext.reset();
 	}
 
 	void Scene::OnScriptsStop()
@@ -476,35 +1243,43 @@ namespace Engine
 
 	void Scene::OnUIUpdate(Timestep ts)
 	{
-		UIEngine::OnUIUpdate(ts, m_ViewportWidth, m_ViewportHeight);
+		UIEngine::OnUIUpdate(this, ts, m_ViewportWidth, m_ViewportHeight);
 	}
 
 	void Scene::OnScriptsUpdate(Timestep ts)
 	{
 		// Update Scripts
-		m_Registry.view<ScriptComponent>().each([=](auto e, const auto& sc)
 		{
-			Entity entity = { e, this };
-			ScriptEngine::OnUpdateEntity(entity, sc, ts);
-		});
+			auto view = m_Registry.view<ScriptComponent>();
+			ECSProfiler::ScopedView profileView(m_ECSProfiler, "Scripts Update", view.size());
+			view.each([=](auto e, const auto& sc)
+			{
+				Entity entity = { e, this };
+				ScriptEngine::OnUpdateEntity(entity, sc, ts);
+			});
+		}
 
 		// Update Native Scripts
-		m_Registry.view<NativeScriptComponent>().each([=](auto e, auto& nsc)
 		{
-			if (!nsc.Instance)
+			auto view = m_Registry.view<NativeScriptComponent>();
+			ECSProfiler::ScopedView profileView(m_ECSProfiler, "Native Scripts Update", view.size());
+			view.each([=](auto e, auto& nsc)
 			{
-				nsc.Instance = nsc.InstantiateScript();
-				nsc.Instance->m_Entity = Entity{ e, this };
-				nsc.Instance->OnCreate();
-			}
+				if (!nsc.Instance)
+				{
+					nsc.Instance = nsc.InstantiateScript();
+					nsc.Instance->m_Entity = Entity{ e, this };
+					nsc.Instance->OnCreate();
+				}
 
-			nsc.Instance->OnUpdate(ts);
-		});
+				nsc.Instance->OnUpdate(ts);
+			});
+		}
 	}
 
 	void Scene::OnPhysics2DUpdate(Timestep ts)
 	{
-		Physics2DEngine::OnPhysicsUpdate(ts);
+		Physics2DEngine::OnPhysicsUpdate(this, ts);
 	}
 
 	void Scene::OnScriptsLateUpdate(Timestep ts)
@@ -517,57 +1292,98 @@ namespace Engine
 		});
 	}
 
-	void Scene::OnRender2DUpdate()
+	void Scene::OnTransformCacheUpdate()
 	{
-		// Draw Sprites
-		m_Registry.view<SpriteRendererComponent>(entt::exclude<UILayoutComponent>).each([=](auto e, auto& sprite)
+		ENGINE_PROFILE_FUNCTION();
+
+		m_Registry.view<TransformComponent>().each([](auto& transform) { transform.RefreshCache(); });
+	}
+
+	void Scene::OnSpatialIndexUpdate()
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		m_Registry.view<TransformComponent>(entt::exclude<UILayoutComponent>).each([=](auto e, auto& transform)
 		{
 			Entity entity = { e, this };
-			Renderer2D::DrawSprite(entity.GetWorldSpaceTransform(), sprite, (int)e);
+			glm::vec2 min, max;
+			GetWorldBounds(entity.GetWorldSpaceAffine2D(), min, max);
+			m_SpatialIndex.Update(e, min, max);
 		});
+	}
+
+	void Scene::OnRender2DUpdate()
+	{
+		// Draw Tilemaps
+		{
+			auto view = m_Registry.view<TilemapComponent>(entt::exclude<UILayoutComponent>);
+			ECSProfiler::ScopedView profileView(m_ECSProfiler, "Render2D Tilemaps", view.size());
+			view.each([=](auto e, auto& tilemap)
+			{
+				Entity entity = { e, this };
+				Renderer2D::DrawTilemap(entity.GetWorldSpaceTransform(), tilemap, (int)e);
+			});
+		}
+
+		// Draw Sprites
+		{
+			auto group = m_Registry.group<SpriteRendererComponent>(entt::get<TransformComponent, RelationshipComponent>, entt::exclude<UILayoutComponent>);
+			ECSProfiler::ScopedView profileView(m_ECSProfiler, "Render2D Sprites", group.size());
+			group.each([=](auto e, auto& sprite, auto& transform, auto& relationship)
+			{
+				Renderer2D::DrawSprite(GetWorldSpaceAffine2D(transform, relationship), sprite, (int)e);
+			});
+		}
 
 		// Draw Circles
-		m_Registry.view<CircleRendererComponent>(entt::exclude<UILayoutComponent>).each([=](auto e, auto& circle)
 		{
-			Entity entity = { e, this };
-			Renderer2D::DrawCircle(entity.GetWorldSpaceTransform(), circle.Color, circle.Thickness, circle.Fade, (int)e);
-		});
+			auto group = m_Registry.group<CircleRendererComponent>(entt::get<TransformComponent, RelationshipComponent>, entt::exclude<UILayoutComponent>);
+			ECSProfiler::ScopedView profileView(m_ECSProfiler, "Render2D Circles", group.size());
+			group.each([=](auto e, auto& circle, auto& transform, auto& relationship)
+			{
+				Renderer2D::DrawCircle(GetWorldSpaceAffine2D(transform, relationship), circle.Color, circle.Thickness, circle.Fade, (int)e);
+			});
+		}
 
 		// Draw Text
-		m_Registry.view<TextRendererComponent>(entt::exclude<UILayoutComponent>).each([=](auto e, auto& trc)
 		{
-			Entity entity = { e, this };
-			Renderer2D::DrawString(trc.TextString, entity.GetWorldSpaceTransform(), trc, (int)e);
-		});
+			auto view = m_Registry.view<TextRendererComponent>(entt::exclude<UILayoutComponent>);
+			ECSProfiler::ScopedView profileView(m_ECSProfiler, "Render2D Text", view.size());
+			view.each([=](auto e, auto& trc)
+			{
+				Entity entity = { e, this };
+				Renderer2D::DrawString(trc.TextString, entity.GetWorldSpaceTransform(), trc, (int)e);
+			});
+		}
 	}
 
 	void Scene::OnRenderUIUpdate()
 	{
 		{ // Draw Images
-			auto view = m_Registry.view<UILayoutComponent, SpriteRendererComponent>();
-			for (auto e : view)
+			auto group = m_Registry.group<>(entt::get<UILayoutComponent, SpriteRendererComponent, TransformComponent, RelationshipComponent>);
+			group.each([=](auto e, auto& layout, auto& sprite, auto& transform, auto& relationship)
 			{
-				Entity entity = { e, this };
-				SpriteRendererComponent sprite = entity.GetComponent<SpriteRendererComponent>();
-
-				if (entity.HasComponent<UIButtonComponent>())
+				Affine2D uiTransform = GetUISpaceAffine2D(GetWorldSpaceAffine2D(transform, relationship), layout);
+				if (UIButtonComponent* uiButton = m_Registry.try_get<UIButtonComponent>(e))
 				{
-					UIButtonComponent uiButton = entity.GetComponent<UIButtonComponent>();
-					sprite.Color *= uiButton.GetButtonTint();
+					// Tint a copy, the component keeps its own color
+					SpriteRendererComponent tinted = sprite;
+					tinted.Color *= uiButton->GetButtonTint();
+					Renderer2D::DrawSprite(uiTransform, tinted, (int)e);
+					return;
 				}
 
-				Renderer2D::DrawSprite(entity.GetUISpaceTransform(), sprite, (int)e);
-			}
+				Renderer2D::DrawSprite(uiTransform, sprite, (int)e);
+			});
 		}
 
 		{ // Draw Circles
-			auto view = m_Registry.view<UILayoutComponent, CircleRendererComponent>();
-			for (auto e : view)
+			auto group = m_Registry.group<>(entt::get<UILayoutComponent, CircleRendererComponent, TransformComponent, RelationshipComponent>);
+			group.each([=](auto e, auto& layout, auto& circle, auto& transform, auto& relationship)
 			{
-				Entity entity = { e, this };
-				CircleRendererComponent circle = entity.GetComponent<CircleRendererComponent>();
-				Renderer2D::DrawCircle(entity.GetUISpaceTransform(), circle.Color, circle.Thickness, circle.Fade, (int)e);
-			}
+				Affine2D uiTransform = GetUISpaceAffine2D(GetWorldSpaceAffine2D(transform, relationship), layout);
+				Renderer2D::DrawCircle(uiTransform, circle.Color, circle.Thickness, circle.Fade, (int)e);
+			});
 		}
 
 		{ // Draw Text
@@ -581,6 +1397,110 @@ namespace Engine
 		}
 	}
 
+	void Scene::ExtractRenderSnapshot(RenderSnapshot& snapshot)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		snapshot.Clear();
+
+		Entity cameraEntity = GetPrimaryCameraEntity();
+		if (cameraEntity)
+		{
+			snapshot.World.Enabled = true;
+			snapshot.World.ViewProjection = cameraEntity.GetComponent<CameraComponent>().Camera.GetProjection() * glm::inverse(cameraEntity.GetWorldSpaceTransform());
+		}
+
+		ExtractRenderSnapshotPasses(snapshot);
+	}
+
+	void Scene::ExtractRenderSnapshot(RenderSnapshot& snapshot, const EditorCamera& camera)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		snapshot.Clear();
+
+		snapshot.World.Enabled = true;
+		snapshot.World.ViewProjection = camera.GetViewProjectionMatrix();
+
+		ExtractRenderSnapshotPasses(snapshot);
+	}
+
+	void Scene::ExtractRenderSnapshotPasses(RenderSnapshot& snapshot)
+	{
+		auto toSnapshotSprite = [](const Affine2D& transform, SpriteRendererComponent& sprite, int entityID)
+		{
+			RenderSnapshot::Sprite snapshotSprite{ transform, sprite.Color, nullptr, nullptr, sprite.Tiling, entityID };
+			if (sprite.Texture.IsValid())
+			{
+				if (sprite.IsSubTexture)
+					snapshotSprite.SubTexture = sprite.SubTexture;
+				else
+					snapshotSprite.Texture = sprite.GetTexture2D();
+			}
+			return snapshotSprite;
+		};
+
+		if (snapshot.World.Enabled)
+		{
+			auto& pass = snapshot.World;
+
+			m_Registry.view<TilemapComponent>(entt::exclude<UILayoutComponent>).each([&](auto e, auto& tilemap)
+			{
+				Entity entity = { e, this };
+				TilemapComponent& copy = snapshot.CopyTilemap((int)e, tilemap);
+				pass.Tilemaps.push_back({ entity.GetWorldSpaceTransform(), tilemap.GetTileset(), &copy, (int)e });
+			});
+
+			auto spriteGroup = m_Registry.group<SpriteRendererComponent>(entt::get<TransformComponent, RelationshipComponent>, entt::exclude<UILayoutComponent>);
+			pass.Sprites.reserve(spriteGroup.size());
+			spriteGroup.each([&](auto e, auto& sprite, auto& transform, auto& relationship)
+			{
+				pass.Sprites.push_back(toSnapshotSprite(GetWorldSpaceAffine2D(transform, relationship), sprite, (int)e));
+			});
+
+			auto circleGroup = m_Registry.group<CircleRendererComponent>(entt::get<TransformComponent, RelationshipComponent>, entt::exclude<UILayoutComponent>);
+			pass.Circles.reserve(circleGroup.size());
+			circleGroup.each([&](auto e, auto& circle, auto& transform, auto& relationship)
+			{
+				pass.Circles.push_back({ GetWorldSpaceAffine2D(transform, relationship), circle.Color, circle.Thickness, circle.Fade, (int)e });
+			});
+
+			m_Registry.view<TextRendererComponent>(entt::exclude<UILayoutComponent>).each([&](auto e, auto& trc)
+			{
+				Entity entity = { e, this };
+				pass.Texts.push_back({ trc.TextString, entity.GetWorldSpaceTransform(), { trc.FontAsset, trc.Color, trc.Kerning, trc.LineSpacing }, (int)e });
+			});
+		}
+
+		auto& ui = snapshot.UI;
+		ui.Enabled = true;
+		ui.ViewProjection = m_ScreenCamera.GetProjection();
+
+		m_Registry.group<>(entt::get<UILayoutComponent, SpriteRendererComponent, TransformComponent, RelationshipComponent>).each([&](auto e, auto& layout, auto& sprite, auto& transform, auto& relationship)
+		{
+			Affine2D uiTransform = GetUISpaceAffine2D(GetWorldSpaceAffine2D(transform, relationship), layout);
+			RenderSnapshot::Sprite snapshotSprite = toSnapshotSprite(uiTransform, sprite, (int)e);
+			if (UIButtonComponent* uiButton = m_Registry.try_get<UIButtonComponent>(e))
+				snapshotSprite.Color *= uiButton->GetButtonTint();
+
+			ui.Sprites.push_back(snapshotSprite);
+		});
+
+		m_Registry.group<>(entt::get<UILayoutComponent, CircleRendererComponent, TransformComponent, RelationshipComponent>).each([&](auto e, auto& layout, auto& circle, auto& transform, auto& relationship)
+		{
+			Affine2D uiTransform = GetUISpaceAffine2D(GetWorldSpaceAffine2D(transform, relationship), layout);
+			ui.Circles.push_back({ uiTransform, circle.Color, circle.Thickness, circle.Fade, (int)e });
+		});
+
+		m_Registry.view<UILayoutComponent, TextRendererComponent>().each([&](auto e, auto& layout, auto& trc)
+		{
+			Entity entity = { e, this };
+			ui.Texts.push_back({ trc.TextString, entity.GetUISpaceTransform(), { trc.FontAsset, trc.Color, trc.Kerning, trc.LineSpacing }, (int)e });
+		});
+
+		snapshot.PruneTilemapCopies();
+	}
+
 #pragma region OnComponentAdded
 	template <typename T>
 	void Scene::OnComponentAdded(Entity entity, T& component)
@@ -630,6 +1550,11 @@ namespace Engine
 	{
 	}
 
+	template<>
+	void Scene::OnComponentAdded<TilemapComponent>(Entity entity, TilemapComponent& component)
+	{
+	}
+
 	template<>
 	void Scene::OnComponentAdded<Rigidbody2DComponent>(Entity entity, Rigidbody2DComponent& component)
 	{
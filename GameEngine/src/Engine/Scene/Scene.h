@@ -1,8 +1,14 @@
 #pragma once
 #include "Engine/Core/Timestep.h"
 #include "Engine/Core/UUID.h"
+#include "Engine/Core/FlatHashMap.h"
+#include "Engine/Math/Affine2D.h"
 #include "Engine/Renderer/EditorCamera.h"
 #include "Engine/Scene/SceneCamera.h"
+#include "Engine/Scene/ECSProfiler.h"
+#include "Engine/Scene/EntityNameIndex.h"
+#include "Engine/Scene/SpatialIndex.h"
+#include "Engine/Scene/SystemScheduler.h"
 #include "Engine/Asset/Assets.h"
 
 #include <entt.hpp>
@@ -12,14 +18,24 @@ class b2World;
 namespace Engine
 {
 	class Entity;
+	class Prefab;
+	class SceneCommandBuffer;
+	class SceneSnapshotBuffer;
+	struct PrefabTemplate;
+	struct TransformComponent;
+	struct RelationshipComponent;
+	struct UILayoutComponent;
+	struct RenderSnapshot;
+	struct Physics2DContext;
+	struct UIContext;
+	struct ScriptContext;
 	
 	class Scene : public Asset
 	{
 	public:
-		Scene() = default;
-		Scene(std::string name)
-			:m_Name(name) {};
-		~Scene() = default;
+		Scene();
+		Scene(std::string name);
+		~Scene();
 		
 		static Ref<Scene> Copy(Ref<Scene> other);
 		void SetSceneName(const std::string& name) { if (!name.empty()) m_Name = name; }
@@ -27,8 +43,21 @@ namespace Engine
 
 		Entity CreateEntity(const std::string& name = std::string());
 		Entity CreateEntityWithUUID(UUID uuid, const std::string& name = std::string());
+		// While running only the script instances are created, the caller runs OnCreate and OnStart as it always had to
 		Entity CreateEntityFromPrefab(AssetHandle prefabHandle);
+		// Builds count instances in one pass, while running despawned instances of the prefab are reused first.
+		// rootTransforms (count of them) replace the prefab root's transform when set.
+		// With startScripts, while running OnCreate and OnStart are called for every scripted node of every instance.
+		std::vector<Entity> InstantiatePrefab(AssetHandle prefabHandle, uint32_t count, const TransformComponent* rootTransforms = nullptr, bool startScripts = true);
+		// While running the instance goes back to its prefab's pool (UUIDs and script instances kept), otherwise it's destroyed
+		void DespawnPrefabInstance(Entity root);
 		void DestroyEntity(Entity entity);
+		// Destroys the entities and their whole subtrees in one pass, physics bodies and audio are released per batch
+		void DestroyEntities(const Entity* entities, size_t count);
+		void DestroyEntities(const std::vector<Entity>& entities);
+		// Adds copies of other's entities, UUIDs included, for additive loading. While running they're started like spawned prefabs.
+		// Returns the merged root entities, nothing is merged if any UUID is already in this scene.
+		std::vector<Entity> MergeScene(const Ref<Scene>& other);
 
 		void OnViewportResize(uint32_t width, uint32_t height);
 		Entity GetPrimaryCameraEntity();
@@ -41,6 +70,13 @@ namespace Engine
 		bool IsEntityHandleValid(entt::entity handle);
 		Entity GetEntityWithUUID(UUID uuid);
 		Entity FindEntityByName(const std::string_view& entityName);
+		std::vector<Entity> FindEntitiesByName(const std::string_view& entityName);
+		std::vector<Entity> FindEntitiesWithNamePrefix(const std::string_view& prefix);
+
+		// World space bounds queries, see GetSpatialIndex
+		std::vector<Entity> FindEntitiesInRegion(const glm::vec2& min, const glm::vec2& max);
+		std::vector<Entity> FindEntitiesAtPoint(const glm::vec2& point);
+		std::vector<Entity> FindEntitiesInRadius(const glm::vec2& center, float radius);
 		Entity CopyEntityFromOtherScene(Entity otherEntity);
 		
 		// Start Play/Sim Whole
@@ -53,26 +89,85 @@ namespace Engine
 
 		// Update Play/Sim Whole
 		void OnUpdateRuntime(Timestep ts);
+		// Advances the runtime by one step without rendering, used by headless runs.
+		// Separate scenes may step on different threads, script and physics work still runs on the main thread.
+		void SimulateRuntime(Timestep ts);
 		void OnUpdateSimulation(Timestep ts, EditorCamera& camera);
 		void OnUpdateEditor(Timestep ts, EditorCamera& camera);
 
+		// Copies render data for the primary camera (or the editor camera) and the screen space UI
+		void ExtractRenderSnapshot(RenderSnapshot& snapshot);
+		void ExtractRenderSnapshot(RenderSnapshot& snapshot, const EditorCamera& camera);
+
 		bool IsRunning() const { return m_IsRunning; }
 		bool IsPaused() const { return m_IsPaused; }
 
 		void SetPaused(bool paused) { m_IsPaused = paused; }
 
+		// Per frame simulation systems, run by OnUpdateRuntime
+		SystemScheduler& GetSystemScheduler() { return m_SystemScheduler; }
+		// Structural changes recorded here are applied after the simulation systems run
+		SceneCommandBuffer& GetCommandBuffer() { return *m_CommandBuffer; }
+		// Bounds of non UI entities, refreshed each runtime/simulation frame after the simulation systems
+		SpatialIndex& GetSpatialIndex() { return m_SpatialIndex; }
+
+		// Rewind/replay history of the gameplay state, recorded after each runtime update. Null while disabled.
+		SceneSnapshotBuffer* GetSnapshotBuffer() { return m_SnapshotBuffer.get(); }
+		void SetSnapshotsEnabled(bool enabled);
+
+		// Subsystem state owned by this scene, null while the subsystem isn't started
+		Physics2DContext* GetPhysics2DContext() { return m_Physics2DContext.get(); }
+		UIContext* GetUIContext() { return m_UIContext.get(); }
+		ScriptContext* GetScriptContext() { return m_ScriptContext.get(); }
+
+		struct PrefabPoolStatistics
+		{
+			uint32_t InstancesSpawned = 0;
+			uint32_t InstancesRecycled = 0;
+			uint32_t InstancesDespawned = 0;
+			uint32_t InstancesPooled = 0;
+		};
+
+		PrefabPoolStatistics GetPrefabPoolStats() const { return m_PrefabPoolStats; }
+
+		// View iteration timings of the builtin systems
+		ECSProfiler& GetECSProfiler() { return m_ECSProfiler; }
+		// Per component pool counts and memory, walks the pools so call it on demand rather than per frame
+		ECSProfiler::MemoryStatistics GetECSMemoryStats() const;
+		bool ExportECSStats(const std::filesystem::path& path) const;
+
 		template<typename... Components>
 		auto GetAllEntitiesWith()
 		{
 			return m_Registry.view<Components...>();
 		}
 
+		// Groups are created up front by CreateGroups, pass the same component lists used there.
+		// A component type can only be owned by one group.
+		template<typename... Owned, typename... Get, typename... Exclude>
+		auto GetGroup(entt::get_t<Get...> get, entt::exclude_t<Exclude...> exclude = {})
+		{
+			return m_Registry.group<Owned...>(get, exclude);
+		}
+
 		static AssetType GetStaticType() { return AssetType::Scene; }
 		virtual AssetType GetAssetType() const override { return GetStaticType(); }
 	private:
 
 		template<typename T>
 		void OnComponentAdded(Entity entity, T& component);
+		// Frees the chunk bodies however a tilemap goes, destroyed with its entity or removed at runtime
+		void OnTilemapDestroyed(entt::registry& registry, entt::entity entity);
+
+		void RegisterBuiltinSystems();
+		void CreateGroups();
+
+		// Entity::GetWorldSpaceAffine2D/GetUISpaceAffine2D for loops that already have the components
+		Affine2D GetWorldSpaceAffine2D(const TransformComponent& transform, const RelationshipComponent& relationship);
+		Affine2D GetUISpaceAffine2D(const Affine2D& worldTransform, const UILayoutComponent& layout) const;
+
+		static const PrefabTemplate& GetPrefabTemplate(Prefab& prefab);
+		void ClearPrefabPools();
 
 		// Start Play/Sim Section
 		void OnUIStart();
@@ -90,11 +185,16 @@ namespace Engine
 		void OnScriptsUpdate(Timestep ts);
 		void OnPhysics2DUpdate(Timestep ts);
 		void OnScriptsLateUpdate(Timestep ts);
+		void OnTransformCacheUpdate();
+		void OnSpatialIndexUpdate();
 		void OnRender2DUpdate();
 		void OnRenderUIUpdate();
+		void ExtractRenderSnapshotPasses(RenderSnapshot& snapshot);
 	private:
 		entt::registry m_Registry;
-		std::unordered_map<UUID, entt::entity> m_EntityMap;
+		FlatHashMap<UUID, entt::entity> m_EntityMap;
+		EntityNameIndex m_NameIndex;
+		SpatialIndex m_SpatialIndex;
 
 		uint32_t m_ViewportWidth = 0, m_ViewportHeight = 0;
 		SceneCamera m_ScreenCamera;
@@ -105,7 +205,28 @@ namespace Engine
 		bool m_IsPaused = false;
 		int m_StepFrames = 0;
 
+		SystemScheduler m_SystemScheduler;
+		Scope<SceneCommandBuffer> m_CommandBuffer;
+		Scope<SceneSnapshotBuffer> m_SnapshotBuffer;
+
+		Scope<Physics2DContext> m_Physics2DContext;
+		Scope<UIContext> m_UIContext;
+		Scope<ScriptContext> m_ScriptContext;
+
+		// Per prefab: UUIDs of despawned instances, in template node order
+		struct PrefabPool
+		{
+			uint64_t TemplateVersion = 0;
+			std::vector<std::vector<UUID>> Instances;
+		};
+		std::unordered_map<AssetHandle, PrefabPool> m_PrefabPools;
+		PrefabPoolStatistics m_PrefabPoolStats;
+
+		ECSProfiler m_ECSProfiler;
+
 		friend class Entity;
+		friend class SceneCommandBuffer;
+		friend class SceneSnapshotBuffer;
 		friend class SceneSerializer;
 		friend class EntitySerializer;
 		friend class PrefabSerializer;
@@ -0,0 +1,165 @@
+#include "enginepch.h"
+#include "Engine/Scene/SceneCommandBuffer.h"
+
+#include "Engine/Scene/Components.h"
+#include "Engine/Scripting/ScriptEngine.h"
+
+namespace Engine
+{
+	UUID SceneCommandBuffer::CreateEntity(const std::string& name)
+	{
+		UUID entityID;
+		Record(Command::Type::CreateEntity, entityID, nullptr, name);
+		return entityID;
+	}
+
+	void SceneCommandBuffer::DestroyEntity(UUID entityID)
+	{
+		Record(Command::Type::DestroyEntity, entityID, nullptr);
+	}
+
+	void SceneCommandBuffer::Modify(UUID entityID, const std::function<void(Entity)>& function)
+	{
+		Record(Command::Type::Modify, entityID, function);
+	}
+
+	void SceneCommandBuffer::Playback(Scene& scene)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			if (m_Commands.empty())
+				return;
+
+			// Commands recorded during playback wait for the next sync point
+			std::swap(m_Commands, m_PlaybackCommands);
+		}
+
+		// Creates go first, in one batch, so every command recorded for a new entity finds it
+		std::vector<UUID> entityIDs;
+		std::vector<TagComponent> tags;
+		for (const auto& command : m_PlaybackCommands)
+		{
+			if (command.CommandType != Command::Type::CreateEntity)
+				continue;
+
+			entityIDs.push_back(command.EntityID);
+			tags.emplace_back(command.Name.empty() ? "Entity" : command.Name);
+		}
+
+		if (!entityIDs.empty())
+		{
+			auto& registry = scene.m_Registry;
+			std::vector<entt::entity> entities(entityIDs.size());
+			registry.create(entities.begin(), entities.end());
+			scene.m_EntityMap.reserve(scene.m_EntityMap.size() + entities.size());
+
+			std::vector<IDComponent> ids;
+			ids.reserve(entityIDs.size());
+			for (size_t i = 0; i < entities.size(); ++i)
+			{
+				ids.emplace_back(entityIDs[i]);
+				scene.m_EntityMap[entityIDs[i]] = entities[i];
+				scene.m_NameIndex.Add(entities[i], tags[i].Tag);
+			}
+
+			registry.insert<IDComponent>(entities.begin(), entities.end(), ids.begin(), ids.end());
+			registry.insert<TransformComponent>(entities.begin(), entities.end());
+			registry.insert<RelationshipComponent>(entities.begin(), entities.end());
+			registry.insert<TagComponent>(entities.begin(), entities.end(), tags.begin(), tags.end());
+
+			if (scene.m_IsRunning)
+			{
+				for (entt::entity e : entities)
+					ScriptEngine::InstantiateEntity({ e, &scene });
+			}
+
+			m_Stats.EntitiesCreated += (uint32_t)entities.size();
+		}
+
+		// Destroys go last so commands recorded for an entity before its destroy still apply
+		std::vector<UUID> destroyed;
+		for (auto& command : m_PlaybackCommands)
+		{
+			m_Stats.CommandsPlayed++;
+
+			switch (command.CommandType)
+			{
+				case Command::Type::CreateEntity:
+					break;
+				case Command::Type::DestroyEntity:
+				{
+					destroyed.push_back(command.EntityID);
+					break;
+				}
+				case Command::Type::Modify:
+				{
+					if (!scene.DoesEntityExist(command.EntityID))
+					{
+						m_Stats.CommandsSkipped++;
+						break;
+					}
+
+					command.Function(scene.GetEntityWithUUID(command.EntityID));
+					break;
+				}
+			}
+		}
+
+		// A repeated destroy does nothing the first one didn't
+		size_t destroyCount = destroyed.size();
+		std::sort(destroyed.begin(), destroyed.end());
+		destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
+		m_Stats.CommandsSkipped += (uint32_t)(destroyCount - destroyed.size());
+
+		std::vector<Entity> destroyedEntities;
+		destroyedEntities.reserve(destroyed.size());
+		for (UUID entityID : destroyed)
+		{
+			// Destroyed before playback, e.g. by a script
+			if (!scene.DoesEntityExist(entityID))
+			{
+				m_Stats.CommandsSkipped++;
+				continue;
+			}
+
+			// Goes with an ancestor that is destroyed too
+			Entity entity = scene.GetEntityWithUUID(entityID);
+			bool underDestroyed = false;
+			for (UUID parentID = entity.GetComponent<RelationshipComponent>().Parent; parentID.IsValid() && !underDestroyed;
+				parentID = scene.GetEntityWithUUID(parentID).GetComponent<RelationshipComponent>().Parent)
+			{
+				underDestroyed = std::binary_search(destroyed.begin(), destroyed.end(), parentID);
+			}
+
+			if (underDestroyed)
+				continue;
+
+			destroyedEntities.push_back(entity);
+			m_Stats.EntitiesDestroyed++;
+		}
+
+		scene.DestroyEntities(destroyedEntities);
+
+		m_PlaybackCommands.clear();
+	}
+
+	void SceneCommandBuffer::Clear()
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		m_Commands.clear();
+	}
+
+	bool SceneCommandBuffer::IsEmpty() const
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		return m_Commands.empty();
+	}
+
+	void SceneCommandBuffer::Record(Command::Type type, UUID entityID, const std::function<void(Entity)>& function, const std::string& name)
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		m_Commands.push_back({ type, entityID, name, function });
+	}
+}
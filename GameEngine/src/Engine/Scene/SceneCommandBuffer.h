@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Engine/Core/UUID.h"
+#include "Engine/Scene/Entity.h"
+
+#include <mutex>
+
+namespace Engine
+{
+	// Records structural changes (create, destroy, add/remove component) so they can be applied
+	// in bulk at a sync point instead of while views are being iterated. Recording is thread safe.
+	class SceneCommandBuffer
+	{
+	public:
+		// The UUID is reserved immediately, the entity exists after the next Playback
+		UUID CreateEntity(const std::string& name = std::string());
+		void DestroyEntity(UUID entityID);
+
+		template<typename T, typename... Args>
+		void AddComponent(UUID entityID, Args&&... args)
+		{
+			T component(std::forward<Args>(args)...);
+			Record(Command::Type::Modify, entityID, [component](Entity entity) { entity.AddOrReplaceComponent<T>(component); });
+		}
+
+		template<typename T>
+		void RemoveComponent(UUID entityID)
+		{
+			Record(Command::Type::Modify, entityID, [](Entity entity)
+			{
+				if (entity.HasComponent<T>())
+					entity.RemoveComponent<T>();
+			});
+		}
+
+		// Runs function on the entity at playback, skipped if the entity no longer exists
+		void Modify(UUID entityID, const std::function<void(Entity)>& function);
+
+		void Playback(Scene& scene);
+		void Clear();
+
+		bool IsEmpty() const;
+
+		struct Statistics
+		{
+			uint32_t CommandsPlayed = 0;
+			uint32_t EntitiesCreated = 0;
+			uint32_t EntitiesDestroyed = 0;
+			uint32_t CommandsSkipped = 0;
+		};
+
+		Statistics GetStats() const { return m_Stats; }
+	private:
+		struct Command
+		{
+			enum class Type { CreateEntity = 0, DestroyEntity, Modify };
+
+			Type CommandType;
+			UUID EntityID;
+			std::string Name;
+			std::function<void(Entity)> Function;
+		};
+
+		void Record(Command::Type type, UUID entityID, const std::function<void(Entity)>& function, const std::string& name = std::string());
+	private:
+		mutable std::mutex m_Mutex;
+		std::vector<Command> m_Commands;
+		std::vector<Command> m_PlaybackCommands;
+
+		Statistics m_Stats;
+	};
+}
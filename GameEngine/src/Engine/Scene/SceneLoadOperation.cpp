@@ -0,0 +1,15 @@
+#include "enginepch.h"
+#include "Engine/Scene/SceneLoadOperation.h"
+
+#include "Engine/Scene/Entity.h"
+
+namespace Engine
+{
+	// Out of line so the header doesn't need Entity, it is reached from Components.h through the project
+	SceneLoadOperation::SceneLoadOperation(AssetHandle handle, SceneLoadMode mode)
+		: m_Handle(handle), m_Mode(mode)
+	{
+	}
+
+	SceneLoadOperation::~SceneLoadOperation() = default;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "Engine/Scene/Scene.h"
+
+namespace Engine
+{
+	class Entity;
+
+	enum class SceneLoadMode
+	{
+		// Replaces the active scene
+		Single = 0,
+		// Merges the scene's entities into the active scene
+		Additive
+	};
+
+	// Returned by SceneManager::LoadSceneAsync, advanced by SceneManager::UpdateSceneLoading on the main thread
+	class SceneLoadOperation
+	{
+	public:
+		enum class State
+		{
+			Parsing = 0, LoadingAssets, Deserializing, Done, Failed
+		};
+
+		SceneLoadOperation(AssetHandle handle, SceneLoadMode mode);
+		~SceneLoadOperation();
+
+		AssetHandle GetHandle() const { return m_Handle; }
+		SceneLoadMode GetMode() const { return m_Mode; }
+		State GetState() const { return m_State; }
+
+		bool IsDone() const { return m_State == State::Done || m_State == State::Failed; }
+		bool HasFailed() const { return m_State == State::Failed; }
+		// 0 to 1
+		float GetProgress() const { return m_Progress; }
+
+		// The active scene once done, for additive loads the scene the entities were merged into
+		const Ref<Scene>& GetScene() const { return m_Scene; }
+		// Root entities added by an additive load, Scene::DestroyEntities unloads them again
+		const std::vector<Entity>& GetEntities() const { return m_Entities; }
+
+	private:
+		AssetHandle m_Handle;
+		SceneLoadMode m_Mode;
+		State m_State = State::Parsing;
+		float m_Progress = 0.0f;
+
+		Ref<Scene> m_Scene;
+		std::vector<Entity> m_Entities;
+
+		friend class RuntimeSceneManager;
+		friend class EditorSceneManager;
+	};
+}
@@ -10,6 +10,16 @@ namespace Engine
 		return Project::GetActive()->GetSceneManager()->LoadScene(handle);
 	}
 
+	Ref<SceneLoadOperation> SceneManager::LoadSceneAsync(const AssetHandle handle, SceneLoadMode mode)
+	{
+		return Project::GetActive()->GetSceneManager()->LoadSceneAsync(handle, mode);
+	}
+
+	void SceneManager::UpdateSceneLoading()
+	{
+		Project::GetActive()->GetSceneManager()->UpdateSceneLoading();
+	}
+
 	Ref<Scene> SceneManager::CreateNewScene(const std::string& name)
 	{
 		return Project::GetActive()->GetSceneManager()->CreateNewScene(name);
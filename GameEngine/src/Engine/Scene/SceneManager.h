@@ -1,5 +1,6 @@
 #pragma once
 #include "Engine/Scene/Scene.h"
+#include "Engine/Scene/SceneLoadOperation.h"
 
 namespace Engine
 {
@@ -7,6 +8,9 @@ namespace Engine
 	{
 	public:
 		static Ref<Scene> LoadScene(const AssetHandle handle);
+		// Loads over several frames, the scene's assets and document are read on worker threads
+		static Ref<SceneLoadOperation> LoadSceneAsync(const AssetHandle handle, SceneLoadMode mode = SceneLoadMode::Single);
+		static void UpdateSceneLoading();
 
 		static Ref<Scene> CreateNewScene(const std::string& name = "Untitled");
 
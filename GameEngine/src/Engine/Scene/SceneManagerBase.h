@@ -1,5 +1,6 @@
 #pragma once
 #include "Engine/Scene/Scene.h"
+#include "Engine/Scene/SceneLoadOperation.h"
 
 #include <map>
 
@@ -9,6 +10,9 @@ namespace Engine
 	{
 	public:
 		virtual Ref<Scene> LoadScene(const AssetHandle handle) = 0;
+		virtual Ref<SceneLoadOperation> LoadSceneAsync(const AssetHandle handle, SceneLoadMode mode = SceneLoadMode::Single) = 0;
+		// Advances pending async loads, call once per frame from the main thread outside of scene updates
+		virtual void UpdateSceneLoading() = 0;
 
 		virtual Ref<Scene> CreateNewScene(const std::string& name = "Untitled") = 0;
 
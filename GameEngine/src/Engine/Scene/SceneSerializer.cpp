@@ -83,6 +83,33 @@ namespace Engine
 	}
 
 	bool SceneSerializer::TryLoadData(const PakAssetEntry& pakEntry, Ref<Asset>& asset) const
+	{
+		YAML::Node data;
+		if (!TryParseData(pakEntry, data))
+			return false;
+
+		std::string sceneName = data["Scene"].as<std::string>();
+		ENGINE_CORE_TRACE("Deserializing scene '{0}'", sceneName);
+
+		asset = CreateRef<Scene>();
+		Ref<Scene> scene = As<Scene>(asset);
+		scene->SetSceneName(sceneName);
+
+		auto entities = data["Entities"];
+		if (entities)
+		{
+			for (auto entity : entities)
+			{
+				Entity thisEntity{ {}, scene.get() };
+				EntitySerializer entitySerializer = EntitySerializer();
+				entitySerializer.Deserialize(entity, thisEntity, scene);
+			}
+		}
+
+		return true;
+	}
+
+	bool SceneSerializer::TryParseData(const PakAssetEntry& pakEntry, YAML::Node& data)
 	{
 		std::filesystem::path assetPakPath = Project::GetActiveAssetPakPath();
 		std::ifstream fileStream(assetPakPath, std::ios::binary);
@@ -99,7 +126,6 @@ namespace Engine
 		fileData.resize(pakEntry.UncompressedSize); //TODO change when compression
 		fileStream.read(fileData.data(), pakEntry.UncompressedSize);
 
-		YAML::Node data;
 		try
 		{
 			data = YAML::Load(fileData.data());
@@ -110,28 +136,7 @@ namespace Engine
 			return false;
 		}
 
-		if (!data["Scene"])
-			return false;
-
-		std::string sceneName = data["Scene"].as<std::string>();
-		ENGINE_CORE_TRACE("Deserializing scene '{0}'", sceneName);
-
-		asset = CreateRef<Scene>();
-		Ref<Scene> scene = As<Scene>(asset);
-		scene->SetSceneName(sceneName);
-
-		auto entities = data["Entities"];
-		if (entities)
-		{
-			for (auto entity : entities)
-			{
-				Entity thisEntity{ {}, scene.get() };
-				EntitySerializer entitySerializer = EntitySerializer();
-				entitySerializer.Deserialize(entity, thisEntity, scene);
-			}
-		}
-
-		return true;
+		return (bool)data["Scene"];
 	}
 
 }
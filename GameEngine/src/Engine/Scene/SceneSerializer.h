@@ -1,6 +1,11 @@
 #pragma once
 #include "Engine/Asset/AssetImporter.h"
 
+namespace YAML
+{
+	class Node;
+}
+
 namespace Engine
 {
 	class SceneSerializer : public AssetSerializer
@@ -10,5 +15,8 @@ namespace Engine
 		virtual const std::vector<char> SerializeForStream(const AssetMetadata& metadata, const Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset) const override;
 		virtual bool TryLoadData(const PakAssetEntry& metadata, Ref<Asset>& asset) const override;
+
+		// Reads and parses the scene document without creating entities, safe to run on worker threads
+		static bool TryParseData(const PakAssetEntry& pakEntry, YAML::Node& data);
 	};
 }
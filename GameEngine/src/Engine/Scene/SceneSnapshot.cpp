@@ -0,0 +1,505 @@
+#include "enginepch.h"
+#include "Engine/Scene/SceneSnapshot.h"
+
+#include "Engine/Core/Timer.h"
+#include "Engine/Scene/Scene.h"
+#include "Engine/Scene/Entity.h"
+#include "Engine/Scene/Components.h"
+#include "Engine/Scripting/ScriptEngine.h"
+
+#include <box2d/b2_body.h>
+
+namespace Engine
+{
+	// Weight of the newest capture in the running average
+	static constexpr float s_AverageWeight = 0.05f;
+	// Budgeting never spaces captures further apart than this
+	static constexpr uint32_t s_MaxInterval = 64;
+
+	static const std::vector<uint8_t> s_NoState;
+
+	enum SnapshotFlags : uint8_t
+	{
+		SnapshotFlags_Rigidbody = 1 << 0,
+		SnapshotFlags_Script = 1 << 1
+	};
+
+	struct TransformState
+	{
+		glm::vec3 Position;
+		glm::vec3 Rotation;
+		glm::vec3 Scale;
+	};
+
+	struct RigidbodyState
+	{
+		glm::vec2 Position;
+		float Angle;
+		glm::vec2 LinearVelocity;
+		float AngularVelocity;
+		glm::vec2 PreviousPosition;
+		float PreviousAngle;
+		uint32_t Awake;
+	};
+
+	// Value type fields only, strings and entity/prefab references are managed objects
+	static uint32_t GetScriptFieldSize(ScriptFieldType type)
+	{
+		switch (type)
+		{
+			case ScriptFieldType::Bool:
+			case ScriptFieldType::SByte:
+			case ScriptFieldType::Byte:		return 1;
+			case ScriptFieldType::Char:
+			case ScriptFieldType::Short:
+			case ScriptFieldType::UShort:	return 2;
+			case ScriptFieldType::Float:
+			case ScriptFieldType::Int:
+			case ScriptFieldType::UInt:		return 4;
+			case ScriptFieldType::Double:
+			case ScriptFieldType::Long:
+			case ScriptFieldType::ULong:
+			case ScriptFieldType::Vector2:	return 8;
+			case ScriptFieldType::Vector3:	return 12;
+			case ScriptFieldType::Vector4:	return 16;
+		}
+
+		return 0;
+	}
+
+	template<typename T>
+	static void Write(std::vector<uint8_t>& data, const T& value)
+	{
+		size_t offset = data.size();
+		data.resize(offset + sizeof(T));
+		memcpy(data.data() + offset, &value, sizeof(T));
+	}
+
+	template<typename T>
+	static T Read(const uint8_t*& data)
+	{
+		T value;
+		memcpy(&value, data, sizeof(T));
+		data += sizeof(T);
+		return value;
+	}
+
+	// Runs of [uint16 unchanged bytes][uint16 changed bytes][changed bytes XOR previous]. Bytes past the end of previous
+	// are XORed with zero, so a keyframe is the same encoding against an empty state.
+	static void EncodeDelta(const std::vector<uint8_t>& state, const std::vector<uint8_t>& previous, std::vector<uint8_t>& encoded)
+	{
+		encoded.clear();
+
+		const size_t size = state.size();
+		const size_t overlap = std::min(size, previous.size());
+		auto delta = [&](size_t i) -> uint8_t { return i < overlap ? state[i] ^ previous[i] : state[i]; };
+
+		size_t i = 0;
+		while (i < size)
+		{
+			size_t unchanged = 0;
+			while (i + unchanged < size && unchanged < UINT16_MAX && delta(i + unchanged) == 0)
+				++unchanged;
+			i += unchanged;
+
+			// Short zero runs stay in the changed bytes, a new run costs 4 bytes
+			size_t end = i;
+			size_t zeros = 0;
+			while (end < size && end - i < UINT16_MAX)
+			{
+				zeros = delta(end) == 0 ? zeros + 1 : 0;
+				++end;
+				if (zeros == 4)
+					break;
+			}
+			end -= zeros;
+
+			Write<uint16_t>(encoded, (uint16_t)unchanged);
+			Write<uint16_t>(encoded, (uint16_t)(end - i));
+			for (; i < end; ++i)
+				encoded.push_back(delta(i));
+		}
+	}
+
+	// state holds the previous state and is decoded in place
+	static void DecodeDelta(const uint8_t* data, size_t size, uint32_t stateSize, std::vector<uint8_t>& state)
+	{
+		state.resize(stateSize);
+
+		const uint8_t* end = data + size;
+		size_t i = 0;
+		while (data < end)
+		{
+			i += Read<uint16_t>(data);
+			uint16_t changed = Read<uint16_t>(data);
+			for (uint16_t j = 0; j < changed; ++j)
+				state[i++] ^= *data++;
+		}
+	}
+
+	SceneSnapshotBuffer::SceneSnapshotBuffer()
+		: SceneSnapshotBuffer(Settings())
+	{
+	}
+
+	SceneSnapshotBuffer::SceneSnapshotBuffer(const Settings& settings)
+		: m_Settings(settings), m_Interval(std::max(settings.Interval, 1u))
+	{
+		m_Buffer.resize(m_Settings.MemoryBudget);
+	}
+
+	void SceneSnapshotBuffer::OnUpdate(Scene& scene, Timestep ts)
+	{
+		m_Time += ts;
+
+		if (++m_FramesSinceCapture < m_Interval)
+			return;
+
+		m_FramesSinceCapture = 0;
+		Capture(scene);
+	}
+
+	void SceneSnapshotBuffer::Capture(Scene& scene)
+	{
+		ENGINE_PROFILE_FUNCTION();
+		Timer timer;
+
+		WriteState(scene, m_State);
+
+		bool keyframe = m_Snapshots.empty() || m_SnapshotsSinceKeyframe >= m_Settings.KeyframeInterval;
+		EncodeDelta(m_State, keyframe ? s_NoState : m_PreviousState, m_Encoded);
+		bool allocated = Allocate(m_Encoded.size());
+
+		// Making room can evict everything the delta was against
+		if (allocated && !keyframe && m_Snapshots.empty())
+		{
+			keyframe = true;
+			EncodeDelta(m_State, s_NoState, m_Encoded);
+			allocated = Allocate(m_Encoded.size());
+		}
+
+		if (!allocated)
+		{
+			ENGINE_CORE_WARN("Scene snapshot of {0} bytes doesn't fit the {1} byte budget", m_Encoded.size(), m_Buffer.size());
+			Clear();
+			return;
+		}
+
+		memcpy(m_Buffer.data() + m_Head, m_Encoded.data(), m_Encoded.size());
+
+		Snapshot& snapshot = m_Snapshots.emplace_back();
+		snapshot.Offset = m_Head;
+		snapshot.Size = (uint32_t)m_Encoded.size();
+		snapshot.StateSize = (uint32_t)m_State.size();
+		snapshot.Time = m_Time;
+		snapshot.Keyframe = keyframe;
+
+		m_Head += m_Encoded.size();
+		m_SnapshotsSinceKeyframe = keyframe ? 1 : m_SnapshotsSinceKeyframe + 1;
+		std::swap(m_State, m_PreviousState);
+
+		float time = timer.ElapsedMillis();
+		m_Stats.LastCaptureTime = time;
+		m_Stats.AverageCaptureTime = m_Stats.Snapshots == 0 ? time : m_Stats.AverageCaptureTime + (time - m_Stats.AverageCaptureTime) * s_AverageWeight;
+		m_Stats.LastSnapshotBytes = m_Encoded.size();
+		m_Stats.LastStateBytes = m_PreviousState.size();
+
+		// Keep the per frame cost in budget by capturing less often, and come back once there's headroom
+		const uint32_t minInterval = std::max(m_Settings.Interval, 1u);
+		if (m_Stats.AverageCaptureTime / m_Interval > m_Settings.TimeBudget && m_Interval < s_MaxInterval)
+			m_Interval *= 2;
+		else if (m_Interval > minInterval && m_Stats.AverageCaptureTime / (m_Interval / 2) < m_Settings.TimeBudget * 0.5f)
+			m_Interval = std::max(m_Interval / 2, minInterval);
+
+		UpdateStats();
+	}
+
+	bool SceneSnapshotBuffer::Restore(Scene& scene, uint32_t index)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (index >= m_Snapshots.size())
+		{
+			ENGINE_CORE_ERROR("Scene snapshot {0} out of range, {1} recorded", index, m_Snapshots.size());
+			return false;
+		}
+
+		std::vector<uint8_t> state;
+		DecodeState(index, state);
+		ReadState(scene, state);
+
+		// Entities moved without going through a system, queries must see where they are now
+		scene.OnTransformCacheUpdate();
+		scene.OnSpatialIndexUpdate();
+		return true;
+	}
+
+	void SceneSnapshotBuffer::Truncate(uint32_t index)
+	{
+		if (index >= m_Snapshots.size())
+			return;
+
+		m_Snapshots.resize(index + 1);
+		const Snapshot& newest = m_Snapshots.back();
+		m_Head = newest.Offset + newest.Size;
+		m_Time = newest.Time;
+		m_FramesSinceCapture = 0;
+
+		m_SnapshotsSinceKeyframe = 0;
+		for (auto it = m_Snapshots.rbegin(); it != m_Snapshots.rend(); ++it)
+		{
+			++m_SnapshotsSinceKeyframe;
+			if (it->Keyframe)
+				break;
+		}
+
+		// The next delta is against the restored state
+		DecodeState(index, m_PreviousState);
+		UpdateStats();
+	}
+
+	bool SceneSnapshotBuffer::Compare(Scene& scene, uint32_t index)
+	{
+		if (index >= m_Snapshots.size())
+			return false;
+
+		std::vector<uint8_t> snapshotState;
+		DecodeState(index, snapshotState);
+
+		std::vector<uint8_t> sceneState;
+		WriteState(scene, sceneState);
+		return sceneState == snapshotState;
+	}
+
+	void SceneSnapshotBuffer::Clear()
+	{
+		m_Snapshots.clear();
+		m_PreviousState.clear();
+		m_Head = 0;
+		m_FramesSinceCapture = 0;
+		m_SnapshotsSinceKeyframe = 0;
+		UpdateStats();
+	}
+
+	void SceneSnapshotBuffer::SetSettings(const Settings& settings)
+	{
+		bool resize = settings.MemoryBudget != m_Settings.MemoryBudget;
+		m_Settings = settings;
+		m_Interval = std::max(settings.Interval, 1u);
+
+		if (resize)
+		{
+			Clear();
+			m_Buffer.clear();
+			m_Buffer.shrink_to_fit();
+			m_Buffer.resize(m_Settings.MemoryBudget);
+		}
+	}
+
+	void SceneSnapshotBuffer::WriteState(Scene& scene, std::vector<uint8_t>& state)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		state.clear();
+		ScriptContext* scriptContext = scene.GetScriptContext();
+
+		scene.GetAllEntitiesWith<IDComponent, TransformComponent>().each([&](auto e, const IDComponent& id, const TransformComponent& transform)
+		{
+			Entity entity = { e, &scene };
+
+			b2Body* body = nullptr;
+			if (entity.HasComponent<Rigidbody2DComponent>())
+				body = (b2Body*)entity.GetComponent<Rigidbody2DComponent>().RuntimeBody;
+
+			ScriptInstance* instance = nullptr;
+			if (scriptContext)
+			{
+				auto it = scriptContext->EntityInstances.find(id.ID);
+				if (it != scriptContext->EntityInstances.end())
+					instance = it->second.get();
+			}
+
+			uint8_t flags = (body ? SnapshotFlags_Rigidbody : 0) | (instance ? SnapshotFlags_Script : 0);
+			Write<uint64_t>(state, id.ID);
+			Write<uint8_t>(state, flags);
+			Write(state, TransformState{ transform.Position, transform.Rotation, transform.Scale });
+
+			if (body)
+			{
+				const auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
+				const b2Vec2& position = body->GetPosition();
+				const b2Vec2& velocity = body->GetLinearVelocity();
+
+				RigidbodyState rigidbody;
+				rigidbody.Position = { position.x, position.y };
+				rigidbody.Angle = body->GetAngle();
+				rigidbody.LinearVelocity = { velocity.x, velocity.y };
+				rigidbody.AngularVelocity = body->GetAngularVelocity();
+				rigidbody.PreviousPosition = rb2d.PreviousPosition;
+				rigidbody.PreviousAngle = rb2d.PreviousAngle;
+				rigidbody.Awake = body->IsAwake();
+				Write(state, rigidbody);
+			}
+
+			if (instance)
+			{
+				// Fields in the class's map order, which stays put until the assembly reloads
+				size_t sizeOffset = state.size();
+				Write<uint16_t>(state, 0);
+				for (auto& [name, field] : instance->GetScriptClass()->GetScriptFields())
+				{
+					uint32_t size = GetScriptFieldSize(field.Type);
+					if (size == 0)
+						continue;
+
+					size_t offset = state.size();
+					state.resize(offset + size);
+					instance->GetFieldValueRaw(field, state.data() + offset);
+				}
+
+				uint16_t fieldBytes = (uint16_t)(state.size() - sizeOffset - sizeof(uint16_t));
+				memcpy(state.data() + sizeOffset, &fieldBytes, sizeof(uint16_t));
+			}
+		});
+	}
+
+	void SceneSnapshotBuffer::ReadState(Scene& scene, const std::vector<uint8_t>& state)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		ScriptContext* scriptContext = scene.GetScriptContext();
+
+		const uint8_t* data = state.data();
+		const uint8_t* end = data + state.size();
+		while (data < end)
+		{
+			UUID entityID = Read<uint64_t>(data);
+			uint8_t flags = Read<uint8_t>(data);
+			TransformState transformState = Read<TransformState>(data);
+
+			RigidbodyState rigidbody;
+			if (flags & SnapshotFlags_Rigidbody)
+				rigidbody = Read<RigidbodyState>(data);
+
+			const uint8_t* fields = nullptr;
+			uint16_t fieldBytes = 0;
+			if (flags & SnapshotFlags_Script)
+			{
+				fieldBytes = Read<uint16_t>(data);
+				fields = data;
+				data += fieldBytes;
+			}
+
+			// Destroyed since the snapshot was taken
+			if (!scene.DoesEntityExist(entityID))
+				continue;
+
+			Entity entity = scene.GetEntityWithUUID(entityID);
+			auto& transform = entity.GetComponent<TransformComponent>();
+			transform.Position = transformState.Position;
+			transform.Rotation = transformState.Rotation;
+			transform.Scale = transformState.Scale;
+
+			if ((flags & SnapshotFlags_Rigidbody) && entity.HasComponent<Rigidbody2DComponent>())
+			{
+				auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
+				rb2d.PreviousPosition = rigidbody.PreviousPosition;
+				rb2d.PreviousAngle = rigidbody.PreviousAngle;
+
+				if (b2Body* body = (b2Body*)rb2d.RuntimeBody)
+				{
+					body->SetTransform({ rigidbody.Position.x, rigidbody.Position.y }, rigidbody.Angle);
+					body->SetLinearVelocity({ rigidbody.LinearVelocity.x, rigidbody.LinearVelocity.y });
+					body->SetAngularVelocity(rigidbody.AngularVelocity);
+					body->SetAwake(rigidbody.Awake != 0);
+				}
+			}
+
+			if (fields && scriptContext)
+			{
+				auto it = scriptContext->EntityInstances.find(entityID);
+				if (it == scriptContext->EntityInstances.end())
+					continue;
+
+				ScriptInstance& instance = *it->second;
+				auto& classFields = instance.GetScriptClass()->GetScriptFields();
+
+				uint32_t expectedBytes = 0;
+				for (auto& [name, field] : classFields)
+					expectedBytes += GetScriptFieldSize(field.Type);
+
+				// Reloaded assembly or a different script, the layout no longer matches
+				if (expectedBytes != fieldBytes)
+					continue;
+
+				for (auto& [name, field] : classFields)
+				{
+					uint32_t size = GetScriptFieldSize(field.Type);
+					if (size == 0)
+						continue;
+
+					instance.SetFieldValueRaw(field, fields);
+					fields += size;
+				}
+			}
+		}
+	}
+
+	void SceneSnapshotBuffer::DecodeState(uint32_t index, std::vector<uint8_t>& state) const
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		// The oldest snapshot is always a keyframe
+		uint32_t keyframe = index;
+		while (!m_Snapshots[keyframe].Keyframe)
+			--keyframe;
+
+		state.clear();
+		for (uint32_t i = keyframe; i <= index; ++i)
+		{
+			const Snapshot& snapshot = m_Snapshots[i];
+			DecodeDelta(m_Buffer.data() + snapshot.Offset, snapshot.Size, snapshot.StateSize, state);
+		}
+	}
+
+	bool SceneSnapshotBuffer::Allocate(size_t size)
+	{
+		if (size > m_Buffer.size())
+			return false;
+
+		if (m_Head + size > m_Buffer.size())
+		{
+			// Snapshots past the head are the oldest, wrapping around overwrites them first
+			while (!m_Snapshots.empty() && m_Snapshots.front().Offset >= m_Head)
+				m_Snapshots.pop_front();
+
+			m_Head = 0;
+		}
+
+		while (!m_Snapshots.empty() && m_Snapshots.front().Offset >= m_Head && m_Snapshots.front().Offset < m_Head + size)
+			m_Snapshots.pop_front();
+
+		// Deltas can't be decoded without their keyframe
+		while (!m_Snapshots.empty() && !m_Snapshots.front().Keyframe)
+			m_Snapshots.pop_front();
+
+		return true;
+	}
+
+	void SceneSnapshotBuffer::UpdateStats()
+	{
+		m_Stats.Snapshots = (uint32_t)m_Snapshots.size();
+		m_Stats.Keyframes = 0;
+		m_Stats.BytesUsed = 0;
+		for (const Snapshot& snapshot : m_Snapshots)
+		{
+			m_Stats.Keyframes += snapshot.Keyframe;
+			m_Stats.BytesUsed += snapshot.Size;
+		}
+
+		m_Stats.Interval = m_Interval;
+		m_Stats.FrameCost = m_Stats.AverageCaptureTime / m_Interval;
+		m_Stats.HistoryDuration = m_Snapshots.empty() ? 0.0f : m_Snapshots.back().Time - m_Snapshots.front().Time;
+		m_Stats.BytesPerSecond = m_Stats.HistoryDuration > 0.0f ? m_Stats.BytesUsed / m_Stats.HistoryDuration : 0.0f;
+	}
+}
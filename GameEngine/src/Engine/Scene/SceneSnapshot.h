@@ -0,0 +1,107 @@
+#pragma once
+#include "Engine/Core/Timestep.h"
+
+#include <deque>
+
+namespace Engine
+{
+	class Scene;
+
+	// Ring buffer of compact binary snapshots of a running scene's gameplay state: transforms, rigidbody state and
+	// value type script fields. Each snapshot is an XOR delta against the previous one, zero runs encoded, with a
+	// full keyframe every KeyframeInterval snapshots. Rewind by restoring an older snapshot and truncating after it.
+	class SceneSnapshotBuffer
+	{
+	public:
+		struct Settings
+		{
+			// Frames between snapshots
+			uint32_t Interval = 1;
+			// Snapshots between keyframes, a restore decodes at most this many deltas
+			uint32_t KeyframeInterval = 60;
+			// Size of the ring buffer in bytes, the oldest snapshots are dropped to make room
+			size_t MemoryBudget = 8 * 1024 * 1024;
+			// Capture time per frame (ms) to stay under, captures are spaced out further while it's exceeded
+			float TimeBudget = 0.5f;
+		};
+
+		struct Statistics
+		{
+			uint32_t Snapshots = 0;
+			uint32_t Keyframes = 0;
+			size_t BytesUsed = 0;
+			size_t LastSnapshotBytes = 0;
+			// Size of the last snapshot before encoding
+			size_t LastStateBytes = 0;
+			float LastCaptureTime = 0.0f; // ms
+			float AverageCaptureTime = 0.0f; // ms
+			// Average capture time spread over the frames between captures
+			float FrameCost = 0.0f; // ms
+			// Frames between snapshots after budgeting, at least Settings::Interval
+			uint32_t Interval = 1;
+			// Seconds of history held and what one second of it costs
+			float HistoryDuration = 0.0f;
+			float BytesPerSecond = 0.0f;
+		};
+
+		SceneSnapshotBuffer();
+		SceneSnapshotBuffer(const Settings& settings);
+
+		// Called by the scene after each runtime update, captures every Interval frames
+		void OnUpdate(Scene& scene, Timestep ts);
+		void Capture(Scene& scene);
+
+		// Writes snapshot index (0 is the oldest) into the scene, entities missing on either side are skipped.
+		// Recording continues from the newest snapshot, call Truncate to continue from the restored one.
+		bool Restore(Scene& scene, uint32_t index);
+		// Drops the snapshots after index
+		void Truncate(uint32_t index);
+		// Whether the scene's current state is exactly snapshot index, for checking restores round trip
+		bool Compare(Scene& scene, uint32_t index);
+		void Clear();
+
+		uint32_t GetSnapshotCount() const { return (uint32_t)m_Snapshots.size(); }
+		// Seconds of scene time since recording started
+		float GetSnapshotTime(uint32_t index) const { return m_Snapshots[index].Time; }
+
+		const Settings& GetSettings() const { return m_Settings; }
+		// Clears the history when the memory budget changes
+		void SetSettings(const Settings& settings);
+
+		const Statistics& GetStats() const { return m_Stats; }
+	private:
+		struct Snapshot
+		{
+			size_t Offset = 0;
+			uint32_t Size = 0;
+			uint32_t StateSize = 0;
+			float Time = 0.0f;
+			bool Keyframe = false;
+		};
+
+		void WriteState(Scene& scene, std::vector<uint8_t>& state);
+		void ReadState(Scene& scene, const std::vector<uint8_t>& state);
+		void DecodeState(uint32_t index, std::vector<uint8_t>& state) const;
+
+		// Makes room for size bytes after the newest snapshot, evicting the oldest ones
+		bool Allocate(size_t size);
+		void UpdateStats();
+	private:
+		Settings m_Settings;
+		Statistics m_Stats;
+
+		std::vector<uint8_t> m_Buffer;
+		size_t m_Head = 0;
+		std::deque<Snapshot> m_Snapshots;
+
+		// Scratch space kept between captures
+		std::vector<uint8_t> m_State;
+		std::vector<uint8_t> m_PreviousState;
+		std::vector<uint8_t> m_Encoded;
+
+		uint32_t m_Interval = 1;
+		uint32_t m_FramesSinceCapture = 0;
+		uint32_t m_SnapshotsSinceKeyframe = 0;
+		float m_Time = 0.0f;
+	};
+}
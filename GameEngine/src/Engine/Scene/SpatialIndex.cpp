@@ -0,0 +1,237 @@
+#include "enginepch.h"
+#include "Engine/Scene/SpatialIndex.h"
+
+namespace Engine
+{
+	// Entities touching more cells than this skip the grid
+	static constexpr int64_t s_MaxCellsPerEntity = 64;
+	// Keeps cell coordinates far from int32 overflow for huge or infinite bounds
+	static constexpr float s_MaxCellCoordinate = (float)(1 << 30);
+
+	size_t SpatialIndex::CellHash::operator()(uint64_t key) const
+	{
+		// splitmix64 finalizer, packed cell coordinates only differ in a few bits
+		key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+		key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+		return key ^ (key >> 31);
+	}
+
+	template<typename Fn>
+	void SpatialIndex::ForEachInRegion(const glm::vec2& min, const glm::vec2& max, Fn&& function) const
+	{
+		auto overlaps = [&min, &max](const Entry& entry)
+		{
+			return entry.Min.x <= max.x && entry.Max.x >= min.x && entry.Min.y <= max.y && entry.Max.y >= min.y;
+		};
+
+		for (entt::entity entity : m_Oversized)
+		{
+			const Entry& entry = m_Entries.at(entity);
+			if (overlaps(entry))
+				function(entity, entry);
+		}
+
+		CellRange range = GetCellRange(min, max);
+
+		// Covering more cells than there are entities, checking every entity is cheaper
+		if (((int64_t)range.MaxX - range.MinX + 1) * ((int64_t)range.MaxY - range.MinY + 1) > (int64_t)m_Entries.size())
+		{
+			for (const auto& [entity, entry] : m_Entries)
+			{
+				if (!entry.Oversized && overlaps(entry))
+					function(entity, entry);
+			}
+			return;
+		}
+
+		for (int32_t y = range.MinY; y <= range.MaxY; ++y)
+		{
+			for (int32_t x = range.MinX; x <= range.MaxX; ++x)
+			{
+				auto cell = m_Cells.find(GetCellKey(x, y));
+				if (cell == m_Cells.end())
+					continue;
+
+				for (entt::entity entity : cell->second)
+				{
+					const Entry& entry = m_Entries.at(entity);
+
+					// An entity spanning several cells is reported only from the first cell the query shares with it
+					if (x != std::max(entry.Cells.MinX, range.MinX) || y != std::max(entry.Cells.MinY, range.MinY))
+						continue;
+
+					if (overlaps(entry))
+						function(entity, entry);
+				}
+			}
+		}
+	}
+
+	SpatialIndex::SpatialIndex(float cellSize)
+		: m_CellSize(cellSize)
+	{
+		ENGINE_CORE_ASSERT(cellSize > 0.0f, "Spatial index cell size must be positive!");
+	}
+
+	void SpatialIndex::Update(entt::entity entity, const glm::vec2& min, const glm::vec2& max)
+	{
+		auto [it, inserted] = m_Entries.try_emplace(entity);
+		Entry& entry = it->second;
+		if (!inserted && entry.Min == min && entry.Max == max)
+			return;
+
+		CellRange cells = GetCellRange(min, max);
+		bool oversized = ((int64_t)cells.MaxX - cells.MinX + 1) * ((int64_t)cells.MaxY - cells.MinY + 1) > s_MaxCellsPerEntity;
+
+		if (!inserted && entry.Cells == cells && entry.Oversized == oversized)
+		{
+			entry.Min = min;
+			entry.Max = max;
+			return;
+		}
+
+		if (!inserted)
+		{
+			Erase(entity, entry);
+			m_CellChanges++;
+		}
+
+		entry.Min = min;
+		entry.Max = max;
+		entry.Cells = cells;
+		entry.Oversized = oversized;
+		Insert(entity, entry);
+	}
+
+	void SpatialIndex::Remove(entt::entity entity)
+	{
+		auto it = m_Entries.find(entity);
+		if (it == m_Entries.end())
+			return;
+
+		Erase(entity, it->second);
+		m_Entries.erase(it);
+	}
+
+	void SpatialIndex::Clear()
+	{
+		m_Entries.clear();
+		m_Cells.clear();
+		m_Oversized.clear();
+	}
+
+	void SpatialIndex::SetCellSize(float cellSize)
+	{
+		ENGINE_CORE_ASSERT(cellSize > 0.0f, "Spatial index cell size must be positive!");
+		if (cellSize == m_CellSize)
+			return;
+
+		m_CellSize = cellSize;
+		m_Cells.clear();
+		m_Oversized.clear();
+
+		for (auto& [entity, entry] : m_Entries)
+		{
+			entry.Cells = GetCellRange(entry.Min, entry.Max);
+			entry.Oversized = ((int64_t)entry.Cells.MaxX - entry.Cells.MinX + 1) * ((int64_t)entry.Cells.MaxY - entry.Cells.MinY + 1) > s_MaxCellsPerEntity;
+			Insert(entity, entry);
+		}
+	}
+
+	void SpatialIndex::QueryRegion(const glm::vec2& min, const glm::vec2& max, std::vector<entt::entity>& entities) const
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		ForEachInRegion(min, max, [&](entt::entity entity, const Entry& entry)
+		{
+			entities.push_back(entity);
+		});
+	}
+
+	void SpatialIndex::QueryPoint(const glm::vec2& point, std::vector<entt::entity>& entities) const
+	{
+		QueryRegion(point, point, entities);
+	}
+
+	void SpatialIndex::QueryRadius(const glm::vec2& center, float radius, std::vector<entt::entity>& entities) const
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		float radiusSquared = radius * radius;
+		ForEachInRegion(center - radius, center + radius, [&](entt::entity entity, const Entry& entry)
+		{
+			glm::vec2 closest = glm::clamp(center, entry.Min, entry.Max);
+			glm::vec2 offset = closest - center;
+			if (glm::dot(offset, offset) <= radiusSquared)
+				entities.push_back(entity);
+		});
+	}
+
+	SpatialIndex::Statistics SpatialIndex::GetStats() const
+	{
+		Statistics stats;
+		stats.EntityCount = (uint32_t)m_Entries.size();
+		stats.CellCount = (uint32_t)m_Cells.size();
+		stats.OversizedCount = (uint32_t)m_Oversized.size();
+		stats.CellChanges = m_CellChanges;
+		return stats;
+	}
+
+	SpatialIndex::CellRange SpatialIndex::GetCellRange(const glm::vec2& min, const glm::vec2& max) const
+	{
+		auto toCell = [this](float value)
+		{
+			return (int32_t)glm::clamp(glm::floor(value / m_CellSize), -s_MaxCellCoordinate, s_MaxCellCoordinate);
+		};
+
+		return { toCell(min.x), toCell(min.y), toCell(max.x), toCell(max.y) };
+	}
+
+	void SpatialIndex::Insert(entt::entity entity, const Entry& entry)
+	{
+		if (entry.Oversized)
+		{
+			m_Oversized.push_back(entity);
+			return;
+		}
+
+		for (int32_t y = entry.Cells.MinY; y <= entry.Cells.MaxY; ++y)
+		{
+			for (int32_t x = entry.Cells.MinX; x <= entry.Cells.MaxX; ++x)
+				m_Cells[GetCellKey(x, y)].push_back(entity);
+		}
+	}
+
+	void SpatialIndex::Erase(entt::entity entity, const Entry& entry)
+	{
+		auto eraseFrom = [entity](std::vector<entt::entity>& entities)
+		{
+			auto it = std::find(entities.begin(), entities.end(), entity);
+			if (it == entities.end())
+				return;
+
+			*it = entities.back();
+			entities.pop_back();
+		};
+
+		if (entry.Oversized)
+		{
+			eraseFrom(m_Oversized);
+			return;
+		}
+
+		for (int32_t y = entry.Cells.MinY; y <= entry.Cells.MaxY; ++y)
+		{
+			for (int32_t x = entry.Cells.MinX; x <= entry.Cells.MaxX; ++x)
+			{
+				auto cell = m_Cells.find(GetCellKey(x, y));
+				if (cell == m_Cells.end())
+					continue;
+
+				eraseFrom(cell->second);
+				if (cell->second.empty())
+					m_Cells.erase(cell);
+			}
+		}
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Engine/Core/FlatHashMap.h"
+
+#include <entt.hpp>
+#include <glm/glm.hpp>
+
+namespace Engine
+{
+	// Scheduler access for a scene's index, systems that query it declare Read<SpatialIndexAccess>().
+	// No component holds it, it only orders those systems against the "SpatialIndex" update.
+	struct SpatialIndexAccess {};
+
+	// Uniform grid over 2D world bounds. Entities are listed in every cell their bounds touch,
+	// anything covering too many cells goes in a separate list checked by every query.
+	// Update is cheap when bounds don't change cells, so it can be called for every entity each frame.
+	// Queries are read only and may run concurrently, updates may not.
+	class SpatialIndex
+	{
+	public:
+		SpatialIndex(float cellSize = 4.0f);
+
+		void Update(entt::entity entity, const glm::vec2& min, const glm::vec2& max);
+		void Remove(entt::entity entity);
+		void Clear();
+
+		// Rebuilds the grid, bounds are kept
+		void SetCellSize(float cellSize);
+		float GetCellSize() const { return m_CellSize; }
+
+		// Results are appended
+		void QueryRegion(const glm::vec2& min, const glm::vec2& max, std::vector<entt::entity>& entities) const;
+		void QueryPoint(const glm::vec2& point, std::vector<entt::entity>& entities) const;
+		void QueryRadius(const glm::vec2& center, float radius, std::vector<entt::entity>& entities) const;
+
+		struct Statistics
+		{
+			uint32_t EntityCount = 0;
+			uint32_t CellCount = 0;
+			uint32_t OversizedCount = 0;
+			// Updates that moved an entity to different cells
+			uint32_t CellChanges = 0;
+		};
+
+		Statistics GetStats() const;
+		void ResetStats() { m_CellChanges = 0; }
+	private:
+		struct CellRange
+		{
+			int32_t MinX = 0, MinY = 0, MaxX = -1, MaxY = -1;
+
+			bool operator==(const CellRange& other) const { return MinX == other.MinX && MinY == other.MinY && MaxX == other.MaxX && MaxY == other.MaxY; }
+			bool operator!=(const CellRange& other) const { return !(*this == other); }
+		};
+
+		struct Entry
+		{
+			glm::vec2 Min{ 0.0f }, Max{ 0.0f };
+			CellRange Cells;
+			bool Oversized = false;
+		};
+
+		struct CellHash
+		{
+			size_t operator()(uint64_t key) const;
+		};
+
+		CellRange GetCellRange(const glm::vec2& min, const glm::vec2& max) const;
+		static uint64_t GetCellKey(int32_t x, int32_t y) { return ((uint64_t)(uint32_t)x << 32) | (uint32_t)y; }
+
+		void Insert(entt::entity entity, const Entry& entry);
+		void Erase(entt::entity entity, const Entry& entry);
+
+		// Calls function once per entity whose bounds overlap the region
+		template<typename Fn>
+		void ForEachInRegion(const glm::vec2& min, const glm::vec2& max, Fn&& function) const;
+	private:
+		float m_CellSize;
+
+		FlatHashMap<entt::entity, Entry> m_Entries;
+		FlatHashMap<uint64_t, std::vector<entt::entity>, CellHash> m_Cells;
+		std::vector<entt::entity> m_Oversized;
+
+		uint32_t m_CellChanges = 0;
+	};
+}
@@ -0,0 +1,179 @@
+#include "enginepch.h"
+#include "Engine/Scene/SystemScheduler.h"
+
+#include "Engine/Core/JobSystem.h"
+#include "Engine/Core/Timer.h"
+
+namespace Engine
+{
+	SceneSystem& SystemScheduler::AddSystem(const std::string& name, const SystemFn& update)
+	{
+		ENGINE_CORE_ASSERT(!GetSystem(name), "System already registered!");
+
+		m_GraphDirty = true;
+
+		SceneSystem& system = m_Systems.emplace_back();
+		system.Name = name;
+		system.Update = update;
+		return system;
+	}
+
+	void SystemScheduler::RemoveSystem(const std::string& name)
+	{
+		auto it = std::find_if(m_Systems.begin(), m_Systems.end(), [&name](const SceneSystem& system) { return system.Name == name; });
+		if (it == m_Systems.end())
+			return;
+
+		m_Systems.erase(it);
+		m_GraphDirty = true;
+	}
+
+	SceneSystem* SystemScheduler::GetSystem(const std::string& name)
+	{
+		for (auto& system : m_Systems)
+		{
+			if (system.Name == name)
+			{
+				// Access may change through the pointer
+				m_GraphDirty = true;
+				return &system;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void SystemScheduler::Run(Scene& scene, entt::registry& registry, Timestep ts)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (m_EnabledSnapshot.size() != m_Systems.size())
+			m_GraphDirty = true;
+		for (size_t i = 0; i < m_Systems.size() && !m_GraphDirty; ++i)
+		{
+			if (m_EnabledSnapshot[i] != m_Systems[i].Enabled)
+				m_GraphDirty = true;
+		}
+
+		if (m_GraphDirty)
+			BuildGraph();
+
+		m_Stats.SystemsRun = (uint32_t)m_Order.size();
+		if (m_Order.empty())
+		{
+			m_Stats.TotalTime = 0.0f;
+			return;
+		}
+
+		for (uint32_t systemIndex : m_Order)
+		{
+			for (auto& prepare : m_Systems[systemIndex].Prepare)
+				prepare(registry);
+		}
+
+		Timer frameTimer;
+
+		Scope<std::atomic<uint32_t>[]> remaining = CreateScope<std::atomic<uint32_t>[]>(m_Order.size());
+		// Each job writes its own slot, LastTime is only set on this thread after Wait
+		std::vector<float> times(m_Order.size(), 0.0f);
+		for (size_t node = 0; node < m_Order.size(); ++node)
+			remaining[node] = m_DependencyCounts[node];
+
+		JobCounter counter;
+		std::function<void(uint32_t)> kickSystem;
+		kickSystem = [&](uint32_t node)
+		{
+			SceneSystem& system = m_Systems[m_Order[node]];
+			JobSystem::Kick([&, node]()
+			{
+				{
+					ENGINE_PROFILE_SCOPE(system.Name.c_str());
+					Timer timer;
+					system.Update(scene, ts);
+					times[node] = timer.ElapsedMillis();
+				}
+
+				for (uint32_t dependent : m_Dependents[node])
+				{
+					if (remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+						kickSystem(dependent);
+				}
+			}, &counter, system.MainThread ? JobAffinity::MainThread : JobAffinity::Any);
+		};
+
+		for (uint32_t node = 0; node < m_Order.size(); ++node)
+		{
+			if (m_DependencyCounts[node] == 0)
+				kickSystem(node);
+		}
+
+		JobSystem::Wait(counter);
+
+		for (size_t node = 0; node < m_Order.size(); ++node)
+			m_Systems[m_Order[node]].LastTime = times[node];
+
+		m_Stats.TotalTime = frameTimer.ElapsedMillis();
+	}
+
+	void SystemScheduler::BuildGraph()
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		m_Order.clear();
+		m_EnabledSnapshot.resize(m_Systems.size());
+		for (uint32_t i = 0; i < m_Systems.size(); ++i)
+		{
+			m_EnabledSnapshot[i] = m_Systems[i].Enabled;
+			if (m_Systems[i].Enabled)
+				m_Order.push_back(i);
+		}
+
+		m_Dependents.assign(m_Order.size(), {});
+		m_DependencyCounts.assign(m_Order.size(), 0);
+
+		std::vector<uint32_t> depth(m_Order.size(), 1);
+		m_Stats.CriticalPathLength = 0;
+
+		for (uint32_t later = 0; later < m_Order.size(); ++later)
+		{
+			for (uint32_t earlier = 0; earlier < later; ++earlier)
+			{
+				if (!Conflicts(m_Systems[m_Order[earlier]], m_Systems[m_Order[later]]))
+					continue;
+
+				m_Dependents[earlier].push_back(later);
+				m_DependencyCounts[later]++;
+				depth[later] = std::max(depth[later], depth[earlier] + 1);
+			}
+
+			m_Stats.CriticalPathLength = std::max(m_Stats.CriticalPathLength, depth[later]);
+		}
+
+		m_GraphDirty = false;
+	}
+
+	bool SystemScheduler::Conflicts(const SceneSystem& first, const SceneSystem& second)
+	{
+		if (first.Exclusive || second.Exclusive)
+			return true;
+
+		auto touches = [](const std::vector<entt::id_type>& access, entt::id_type id)
+		{
+			return std::find(access.begin(), access.end(), id) != access.end();
+		};
+
+		for (entt::id_type id : first.Writes)
+		{
+			if (touches(second.Reads, id) || touches(second.Writes, id))
+				return true;
+		}
+
+		for (entt::id_type id : second.Writes)
+		{
+			if (touches(first.Reads, id))
+				return true;
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Engine/Core/Timestep.h"
+
+#include <entt.hpp>
+
+namespace Engine
+{
+	class Scene;
+
+	using SystemFn = std::function<void(Scene&, Timestep)>;
+
+	// A unit of per-frame scene work and the components it touches
+	struct SceneSystem
+	{
+		std::string Name;
+		SystemFn Update;
+		bool Enabled = true;
+
+		// Touches state the scheduler can't see (scripts, physics world), runs alone
+		bool Exclusive = false;
+		// Touches Mono or GL, only the main thread may run it
+		bool MainThread = false;
+
+		// TransformComponent getters never touch its matrix cache, so reading transforms in parallel is safe.
+		// Only TransformComponent::RefreshCache writes the cache, declare Write<TransformComponent>() to call it.
+		std::vector<entt::id_type> Reads;
+		std::vector<entt::id_type> Writes;
+		// Creates the component pools up front, entt creates them lazily and that isn't thread safe
+		std::vector<std::function<void(entt::registry&)>> Prepare;
+
+		// Set by the thread calling SystemScheduler::Run once all systems are done, not by the job that ran it
+		float LastTime = 0.0f; // ms
+
+		template<typename... Components>
+		SceneSystem& Read()
+		{
+			(AddAccess<Components>(Reads), ...);
+			return *this;
+		}
+
+		template<typename... Components>
+		SceneSystem& Write()
+		{
+			(AddAccess<Components>(Writes), ...);
+			return *this;
+		}
+
+		SceneSystem& RunExclusive() { Exclusive = true; return *this; }
+		SceneSystem& RunOnMainThread() { MainThread = true; return *this; }
+	private:
+		template<typename Component>
+		void AddAccess(std::vector<entt::id_type>& access)
+		{
+			access.push_back(entt::type_info<Component>::id());
+			Prepare.push_back([](entt::registry& registry) { registry.view<Component>(); });
+		}
+	};
+
+	// Orders systems by registration, a later system waits only for earlier ones it conflicts with.
+	// Systems that don't conflict run in parallel on the JobSystem.
+	class SystemScheduler
+	{
+	public:
+		SceneSystem& AddSystem(const std::string& name, const SystemFn& update);
+		void RemoveSystem(const std::string& name);
+		SceneSystem* GetSystem(const std::string& name);
+		const std::vector<SceneSystem>& GetSystems() const { return m_Systems; }
+
+		// Called on the main thread, or from a job as Engine-Headless --instances does. MainThread systems are
+		// always kicked to the main thread, so from a job that only finishes while the main thread is draining
+		// main thread jobs, in JobSystem::Wait or ExecuteMainThreadJobs.
+		void Run(Scene& scene, entt::registry& registry, Timestep ts);
+
+		struct Statistics
+		{
+			uint32_t SystemsRun = 0;
+			// Longest chain of dependent systems
+			uint32_t CriticalPathLength = 0;
+			float TotalTime = 0.0f; // ms
+		};
+
+		Statistics GetStats() const { return m_Stats; }
+	private:
+		void BuildGraph();
+		static bool Conflicts(const SceneSystem& first, const SceneSystem& second);
+	private:
+		std::vector<SceneSystem> m_Systems;
+
+		// Per enabled system: indices of the systems that wait on it and how many it waits on
+		std::vector<uint32_t> m_Order;
+		std::vector<std::vector<uint32_t>> m_Dependents;
+		std::vector<uint32_t> m_DependencyCounts;
+		std::vector<bool> m_EnabledSnapshot;
+		bool m_GraphDirty = true;
+
+		Statistics m_Stats;
+	};
+}
@@ -6,6 +6,7 @@
 
 #include "Engine/Core/Application.h"
 #include "Engine/Core/UUID.h"
+#include "Engine/Core/FlatHashMap.h"
 #include "Engine/Asset/AssetManager.h"
 #include "Engine/Scene/Entity.h"
 #include "Engine/Scene/Prefab.h"
@@ -112,10 +113,9 @@ namespace Engine
 		MonoClass* Physics2DContactStruct = nullptr;
 
 		std::unordered_map<std::string, Ref<ScriptClass>> EntityClasses;
-		std::unordered_map<UUID, Ref<ScriptInstance>> EntityInstances;
-		std::unordered_map<UUID, Ref<ScriptInstance>> AssetInstances;
-		std::unordered_map<UUID, ScriptFieldMap> EntityScriptFields;
-		std::unordered_map<UUID, ScriptFieldMap> AssetScriptFields;
+		FlatHashMap<UUID, Ref<ScriptInstance>> AssetInstances;
+		FlatHashMap<UUID, ScriptFieldMap> EntityScriptFields;
+		FlatHashMap<UUID, ScriptFieldMap> AssetScriptFields;
 		std::unordered_map<std::string, ScriptFieldMap> ScriptFieldsDefaults;
 		std::unordered_map<std::string, ScriptMethodMap> ScriptMethodMap;
 
@@ -124,6 +124,24 @@ namespace Engine
 	};
 
 	static ScriptEngineData* s_ScriptEngineData = nullptr;
+	static thread_local Scene* s_SceneContext = nullptr;
+
+	// Points internal calls at the entity's scene for the duration of a callback
+	struct ScopedSceneContext
+	{
+		ScopedSceneContext(Scene* scene)
+			: PreviousContext(s_SceneContext) { s_SceneContext = scene; }
+		~ScopedSceneContext() { s_SceneContext = PreviousContext; }
+
+		Scene* PreviousContext;
+	};
+
+	static FlatHashMap<UUID, Ref<ScriptInstance>>& GetEntityInstances(Entity entity)
+	{
+		ScriptContext* context = entity.GetScene()->GetScriptContext();
+		ENGINE_CORE_ASSERT(context, "Scene scripts haven't been created!");
+		return context->EntityInstances;
+	}
 
 	static bool CheckMonoError(MonoError& error)
 	{
@@ -233,7 +251,6 @@ namespace Engine
 
 		ShutdownMono();
 
-		s_ScriptEngineData->EntityInstances.clear();
 		s_ScriptEngineData->AssetInstances.clear();
 		s_ScriptEngineData->EntityClasses.clear();
 		s_ScriptEngineData->EntityScriptFields.clear();
@@ -336,11 +353,10 @@ namespace Engine
 		s_ScriptEngineData->AppAssembly = nullptr;
 
 		// save copy of EntityScript Fields to restore values after reload
-		std::unordered_map<UUID, ScriptFieldMap> PreviousEntityScriptFields = s_ScriptEngineData->EntityScriptFields;
-		std::unordered_map<UUID, ScriptFieldMap> PreviousAssetScriptFields = s_ScriptEngineData->AssetScriptFields;
+		FlatHashMap<UUID, ScriptFieldMap> PreviousEntityScriptFields = s_ScriptEngineData->EntityScriptFields;
+		FlatHashMap<UUID, ScriptFieldMap> PreviousAssetScriptFields = s_ScriptEngineData->AssetScriptFields;
 
 		// clear s_ScriptEngineData
-		s_ScriptEngineData->EntityInstances.clear();
 		s_ScriptEngineData->AssetInstances.clear();
 		s_ScriptEngineData->EntityClasses.clear();
 		s_ScriptEngineData->EntityScriptFields.clear();
@@ -619,12 +635,12 @@ namespace Engine
 			if (EntityInstanceExists(entity))
 			{
 				ENGINE_CORE_ERROR("Tried to Create Entity Instance for {}, but it already existed!", entity.GetUUID());
-				return s_ScriptEngineData->EntityInstances.at(entity.GetUUID());
+				return GetEntityInstances(entity).at(entity.GetUUID());
 			}
 
 			Ref<ScriptClass> scriptClass = s_ScriptEngineData->EntityClasses.at(scriptName);
 			Ref<ScriptInstance> instance = CreateRef<ScriptInstance>(scriptClass, entity);
-			s_ScriptEngineData->EntityInstances[entity.GetUUID()] = instance;
+			GetEntityInstances(entity)[entity.GetUUID()] = instance;
 
 			return instance;
 		}
@@ -637,11 +653,33 @@ namespace Engine
 		if (EntityInstanceExists(entity))
 		{
 			mono_gchandle_free(instance->m_GCHandle);
-			s_ScriptEngineData->EntityInstances.erase(entity.GetUUID());
+			GetEntityInstances(entity).erase(entity.GetUUID());
 			instance = nullptr;
 		}
 	}
 
+	Scene* ScriptEngine::GetSceneContext()
+	{
+		return s_SceneContext;
+	}
+
+	void ScriptEngine::SetSceneContext(Scene* scene)
+	{
+		s_SceneContext = scene;
+	}
+
+	void ScriptEngine::OnRuntimeStop(Scene* scene)
+	{
+		ScriptContext* context = scene->GetScriptContext();
+		if (!context)
+			return;
+
+		for (auto& [entityID, instance] : context->EntityInstances)
+			mono_gchandle_free(instance->m_GCHandle);
+
+		context->EntityInstances.clear();
+	}
+
 	void ScriptEngine::InstantiateAsset(AssetHandle handle)
 	{
 		Ref<ScriptClass> scriptClass = s_ScriptEngineData->PrefabClass; // TODO change once all asset types work
@@ -664,7 +702,7 @@ namespace Engine
 		Ref<ScriptInstance> instance = CreateRef<ScriptInstance>(scriptClass, entity);
 		ENGINE_CORE_ASSERT(instance, "Script Instance failed to be created for entityID: " + std::to_string(entityID) + ", with class: " + scriptClass->m_ClassName);
 		
-		s_ScriptEngineData->EntityInstances[entityID] = instance;
+		GetEntityInstances(entity)[entityID] = instance;
 	}
 
 	void ScriptEngine::OnCreateEntity(Entity entity, const ScriptComponent& sc)
@@ -673,7 +711,7 @@ namespace Engine
 			return;
 
 		UUID entityID = entity.GetUUID();
-		Ref<ScriptInstance> instance = s_ScriptEngineData->EntityInstances.at(entityID);
+		Ref<ScriptInstance> instance = GetEntityInstances(entity).at(entityID);
 
 		if (entity.HasComponent<PrefabComponent>())
 		{
@@ -692,10 +730,10 @@ namespace Engine
 					case ScriptFieldType::Entity:
 					{
 						uint64_t fieldEntityID = fieldInstance.GetValue<uint64_t>();
-						if (!SceneManager::GetActiveScene()->DoesEntityExist(fieldEntityID))
+						if (!entity.GetScene()->DoesEntityExist(fieldEntityID))
 							continue;
 
-						Entity fieldEntity = SceneManager::GetActiveScene()->GetEntityWithUUID(fieldEntityID);
+						Entity fieldEntity = entity.GetScene()->GetEntityWithUUID(fieldEntityID);
 
 						auto& fieldEntityInstance = ScriptEngine::GetEntityInstance(fieldEntity);
 						instance->SetFieldValueInternal(name, fieldEntityInstance->GetMonoObject());
@@ -733,10 +771,10 @@ namespace Engine
 				case ScriptFieldType::Entity:
 				{
 					uint64_t fieldEntityID = fieldInstance.GetValue<uint64_t>();
-					if (!SceneManager::GetActiveScene()->DoesEntityExist(fieldEntityID))
+					if (!entity.GetScene()->DoesEntityExist(fieldEntityID))
 						continue;
 
-					Entity fieldEntity = SceneManager::GetActiveScene()->GetEntityWithUUID(fieldEntityID);
+					Entity fieldEntity = entity.GetScene()->GetEntityWithUUID(fieldEntityID);
 
 					auto& fieldEntityInstance = ScriptEngine::GetEntityInstance(fieldEntity);
 					instance->SetFieldValueInternal(name, fieldEntityInstance->GetMonoObject());
@@ -759,30 +797,47 @@ namespace Engine
 			}
 		}
 
+		ScopedSceneContext sceneContext(entity.GetScene());
 		instance->InvokeOnCreate();
 	}
 
 	void ScriptEngine::OnStartEntity(Entity entity, const ScriptComponent& sc)
 	{
 		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
-			s_ScriptEngineData->EntityInstances.at(entity.GetUUID())->InvokeOnStart();
+		{
+			ScopedSceneContext sceneContext(entity.GetScene());
+			GetEntityInstances(entity).at(entity.GetUUID())->InvokeOnStart();
+		}
 	}
 
 	void ScriptEngine::OnDestroyEntity(Entity entity, const ScriptComponent& sc)
 	{
 		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
 		{
-			Ref<ScriptInstance> instance = s_ScriptEngineData->EntityInstances.at(entity.GetUUID());
+			Ref<ScriptInstance> instance = GetEntityInstances(entity).at(entity.GetUUID());
+			ScopedSceneContext sceneContext(entity.GetScene());
 			instance->InvokeOnDestroy();
 
 			DeleteEntityInstance(instance, entity);
 		}
 	}
 
+	void ScriptEngine::OnDespawnEntity(Entity entity, const ScriptComponent& sc)
+	{
+		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
+		{
+			ScopedSceneContext sceneContext(entity.GetScene());
+			GetEntityInstances(entity).at(entity.GetUUID())->InvokeOnDestroy();
+		}
+	}
+
 	void ScriptEngine::OnUpdateEntity(Entity entity, const ScriptComponent& sc, Timestep ts)
 	{
 		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
-			s_ScriptEngineData->EntityInstances.at(entity.GetUUID())->InvokeOnUpdate((float)ts);
+		{
+			ScopedSceneContext sceneContext(entity.GetScene());
+			GetEntityInstances(entity).at(entity.GetUUID())->InvokeOnUpdate((float)ts);
+		}
 	}
 
 	void ScriptEngine::OnLateUpdateEntity(Entity entity, const ScriptComponent& sc, Timestep ts)
@@ -790,7 +845,10 @@ namespace Engine
 		//const auto& sc = entity.GetComponent<ScriptComponent>();
 
 		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
-			s_ScriptEngineData->EntityInstances.at(entity.GetUUID())->InvokeOnLateUpdate((float)ts);
+		{
+			ScopedSceneContext sceneContext(entity.GetScene());
+			GetEntityInstances(entity).at(entity.GetUUID())->InvokeOnLateUpdate((float)ts);
+		}
 	}
 
 	void ScriptEngine::OnTriggerEnter2D(Entity entity, Physics2DContact contact2D)
@@ -798,7 +856,10 @@ namespace Engine
 		const auto& sc = entity.GetComponent<ScriptComponent>();
 
 		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
-			s_ScriptEngineData->EntityInstances.at(entity.GetUUID())->InvokeOnTriggerEnter2D(contact2D);
+		{
+			ScopedSceneContext sceneContext(entity.GetScene());
+			GetEntityInstances(entity).at(entity.GetUUID())->InvokeOnTriggerEnter2D(contact2D);
+		}
 	}
 
 	void ScriptEngine::OnTriggerExit2D(Entity entity, Physics2DContact contact2D)
@@ -806,7 +867,10 @@ namespace Engine
 		const auto& sc = entity.GetComponent<ScriptComponent>();
 
 		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
-			s_ScriptEngineData->EntityInstances.at(entity.GetUUID())->InvokeOnTriggerExit2D(contact2D);
+		{
+			ScopedSceneContext sceneContext(entity.GetScene());
+			GetEntityInstances(entity).at(entity.GetUUID())->InvokeOnTriggerExit2D(contact2D);
+		}
 	}
 
 	void ScriptEngine::OnCollisionEnter2D(Entity entity, Physics2DContact contact2D)
@@ -814,7 +878,10 @@ namespace Engine
 		const auto& sc = entity.GetComponent<ScriptComponent>();
 
 		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
-			s_ScriptEngineData->EntityInstances.at(entity.GetUUID())->InvokeOnCollisionEnter2D(contact2D);
+		{
+			ScopedSceneContext sceneContext(entity.GetScene());
+			GetEntityInstances(entity).at(entity.GetUUID())->InvokeOnCollisionEnter2D(contact2D);
+		}
 	}
 
 	void ScriptEngine::OnCollisionExit2D(Entity entity, Physics2DContact contact2D)
@@ -822,12 +889,15 @@ namespace Engine
 		const auto& sc = entity.GetComponent<ScriptComponent>();
 
 		if (EntityClassExists(sc.ClassName) && EntityInstanceExists(entity))
-			s_ScriptEngineData->EntityInstances.at(entity.GetUUID())->InvokeOnCollisionExit2D(contact2D);
+		{
+			ScopedSceneContext sceneContext(entity.GetScene());
+			GetEntityInstances(entity).at(entity.GetUUID())->InvokeOnCollisionExit2D(contact2D);
+		}
 	}
 
 	bool ScriptEngine::EntityInstanceExists(Entity& entity)
 	{
-		const auto& entityInstances = s_ScriptEngineData->EntityInstances;
+		const auto& entityInstances = GetEntityInstances(entity);
 		if (entityInstances.find(entity.GetUUID()) != entityInstances.end())
 		{
 			const auto& instance = entityInstances.at(entity.GetUUID());
@@ -846,7 +916,7 @@ namespace Engine
 	Ref<ScriptInstance> ScriptEngine::GetEntityInstance(Entity entity)
 	{
 		if (EntityInstanceExists(entity))
-			return s_ScriptEngineData->EntityInstances.at(entity.GetUUID());
+			return GetEntityInstances(entity).at(entity.GetUUID());
 
 		return nullptr;
 	}
@@ -1115,6 +1185,20 @@ namespace Engine
 		return true;
 	}
 
+	void ScriptInstance::GetFieldValueRaw(const ScriptField& field, void* buffer)
+	{
+		MonoObject* instance = GetMonoObject();
+		if (instance)
+			mono_field_get_value(instance, field.ClassField, buffer);
+	}
+
+	void ScriptInstance::SetFieldValueRaw(const ScriptField& field, const void* value)
+	{
+		MonoObject* instance = GetMonoObject();
+		if (instance)
+			mono_field_set_value(instance, field.ClassField, (void*)value);
+	}
+
 	ScriptClass::ScriptClass(const std::string& classNamespace, const std::string& className, bool isCore)
 		: m_ClassNamespace(classNamespace), m_ClassName(className), m_IsCore(isCore)
 	{
@@ -158,6 +158,14 @@ namespace Engine
 		friend class ScriptEngine;
 	};
 
+	class ScriptInstance;
+
+	// Script instances of a running scene's entities, owned by the scene
+	struct ScriptContext
+	{
+		FlatHashMap<UUID, Ref<ScriptInstance>> EntityInstances;
+	};
+
 	class ScriptEngine
 	{
 	public:
@@ -181,11 +189,21 @@ namespace Engine
 		static Ref<ScriptInstance> CreateEntityInstance(Entity entity, const std::string& scriptName);
 		static void DeleteEntityInstance(Ref<ScriptInstance> instance, Entity entity);
 
+		// Scene that internal calls resolve entity IDs against. Set around every script callback and
+		// kept per thread, so scenes updating on different threads don't see each other's entities.
+		static Scene* GetSceneContext();
+		static void SetSceneContext(Scene* scene);
+
+		// Releases the instances still held by the scene's script context
+		static void OnRuntimeStop(Scene* scene);
+
 		static void InstantiateAsset(AssetHandle handle);
 		static void InstantiateEntity(Entity entity);
 		static void OnCreateEntity(Entity entity, const ScriptComponent& sc);
 		static void OnStartEntity(Entity entity, const ScriptComponent& sc);
 		static void OnDestroyEntity(Entity entity, const ScriptComponent& sc);
+		// Invokes OnDestroy but keeps the instance so a pooled entity can reuse it
+		static void OnDespawnEntity(Entity entity, const ScriptComponent& sc);
 		static void OnUpdateEntity(Entity entity, const ScriptComponent& sc, Timestep ts);
 		static void OnLateUpdateEntity(Entity entity, const ScriptComponent& sc, Timestep ts);
 
@@ -288,6 +306,10 @@ namespace Engine
 			SetFieldValueInternal(name, ScriptEngine::StringToMonoString(*value));
 		}
 
+		// Skips the name lookup, for callers walking the class's fields (e.g. scene snapshots). Value type fields only.
+		void GetFieldValueRaw(const ScriptField& field, void* buffer);
+		void SetFieldValueRaw(const ScriptField& field, const void* value);
+
 		void InvokeOnCreate();
 		void InvokeOnStart();
 		void InvokeOnDestroy();
@@ -5,6 +5,7 @@
 #include "Engine/Core/Application.h"
 #include "Engine/Scene/Scene.h"
 #include "Engine/Scene/Entity.h"
+#include "Engine/Scene/SceneCommandBuffer.h"
 #include "Engine/Scene/Prefab.h"
 #include "Engine/Math/Random.h"
 #include "Engine/Physics/Physics2D.h"
@@ -22,16 +23,29 @@ namespace InternalCalls
 
 	static Engine::Entity GetEntityFromScene(Engine::UUID entityID)
 	{
-		Engine::Scene* scene = Engine::SceneManager::GetActiveScene().get();
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
 		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
 		Engine::Entity entity = scene->GetEntityWithUUID(entityID);
 		ENGINE_CORE_ASSERT(entity, "Entity with UUID: " + std::to_string(entityID) + " was not found in Scene!");
 		return entity;
 	}
 
+	static MonoArray* EntitiesToMonoArray(const std::vector<Engine::Entity>& entities)
+	{
+		if (entities.empty())
+			return nullptr;
+
+		std::vector<Engine::UUID> entityIDs;
+		entityIDs.reserve(entities.size());
+		for (Engine::Entity entity : entities)
+			entityIDs.push_back(entity.GetUUID());
+
+		return Engine::ScriptEngine::ArrayToMonoArray(entityIDs.data(), Engine::ScriptFieldType::ULong, entityIDs.size());
+	}
+
 	static Engine::Entity GetEntityFromScene(std::string entityName)
 	{
-		Engine::Scene* scene = Engine::SceneManager::GetActiveScene().get();
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
 		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
 		Engine::Entity entity = scene->FindEntityByName(entityName);
 		ENGINE_CORE_ASSERT(entity, "Entity with name: " + entityName + " was not found in Scene!");
@@ -102,10 +116,17 @@ namespace InternalCalls
 		ENGINE_ADD_INTERNAL_CALL(Entity_HasComponent);
 		ENGINE_ADD_INTERNAL_CALL(Entity_AddComponent);
 		ENGINE_ADD_INTERNAL_CALL(Entity_FindEntityByName);
+		ENGINE_ADD_INTERNAL_CALL(Entity_FindEntitiesByName);
+		ENGINE_ADD_INTERNAL_CALL(Entity_FindEntitiesWithNamePrefix);
+		ENGINE_ADD_INTERNAL_CALL(Entity_FindEntitiesInRegion);
+		ENGINE_ADD_INTERNAL_CALL(Entity_FindEntitiesAtPoint);
+		ENGINE_ADD_INTERNAL_CALL(Entity_FindEntitiesInRadius);
 		ENGINE_ADD_INTERNAL_CALL(Entity_CreateEntity);
 		ENGINE_ADD_INTERNAL_CALL(Entity_InstantiatePrefab);
+		ENGINE_ADD_INTERNAL_CALL(Entity_InstantiatePrefabs);
 		ENGINE_ADD_INTERNAL_CALL(Entity_GetScriptInstance);
 		ENGINE_ADD_INTERNAL_CALL(Entity_DestroyEntity);
+		ENGINE_ADD_INTERNAL_CALL(Entity_Despawn);
 		ENGINE_ADD_INTERNAL_CALL(Entity_GetParent);
 		ENGINE_ADD_INTERNAL_CALL(Entity_SetParent);
 		ENGINE_ADD_INTERNAL_CALL(Entity_GetChildren);
@@ -499,10 +520,47 @@ namespace InternalCalls
 		return entity.GetUUID();
 	}
 
+	MonoArray* ScriptGlue::Entity_FindEntitiesByName(MonoString* name)
+	{
+		std::string entityName = Engine::ScriptEngine::MonoStringToUTF8(name);
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
+		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
+		return EntitiesToMonoArray(scene->FindEntitiesByName(entityName));
+	}
+
+	MonoArray* ScriptGlue::Entity_FindEntitiesWithNamePrefix(MonoString* prefix)
+	{
+		std::string namePrefix = Engine::ScriptEngine::MonoStringToUTF8(prefix);
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
+		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
+		return EntitiesToMonoArray(scene->FindEntitiesWithNamePrefix(namePrefix));
+	}
+
+	MonoArray* ScriptGlue::Entity_FindEntitiesInRegion(glm::vec2* min, glm::vec2* max)
+	{
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
+		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
+		return EntitiesToMonoArray(scene->FindEntitiesInRegion(*min, *max));
+	}
+
+	MonoArray* ScriptGlue::Entity_FindEntitiesAtPoint(glm::vec2* point)
+	{
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
+		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
+		return EntitiesToMonoArray(scene->FindEntitiesAtPoint(*point));
+	}
+
+	MonoArray* ScriptGlue::Entity_FindEntitiesInRadius(glm::vec2* center, float radius)
+	{
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
+		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
+		return EntitiesToMonoArray(scene->FindEntitiesInRadius(*center, radius));
+	}
+
 	uint64_t ScriptGlue::Entity_CreateEntity(MonoString* name)
 	{
 		std::string entityName = Engine::ScriptEngine::MonoStringToUTF8(name);
-		Engine::Scene* scene = Engine::SceneManager::GetActiveScene().get();
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
 		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
 		Engine::Entity entity = scene->CreateEntity(entityName);
 		if (!entity)
@@ -525,22 +583,48 @@ namespace InternalCalls
 			return 0;
 		}
 
-		Engine::Scene* scene = Engine::SceneManager::GetActiveScene().get();
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
 		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
-		Engine::Entity entity = scene->CreateEntityFromPrefab(prefabID);
+		// Runs OnCreate and OnStart for every scripted entity of the instance, not just the root
+		Engine::Entity entity = scene->InstantiatePrefab(prefabID, 1).front();
 		if (!entity)
 		{
 			return 0;
 		}
 
-		if (entity.HasComponent<Engine::ScriptComponent>())
+		return entity.GetUUID();
+	}
+
+	MonoArray* ScriptGlue::Entity_InstantiatePrefabs(Engine::AssetHandle prefabID, MonoArray* positions)
+	{
+		if (!prefabID.IsValid() || !positions)
 		{
-			Engine::ScriptComponent sc = entity.GetComponent<Engine::ScriptComponent>();
-			Engine::ScriptEngine::OnCreateEntity(entity, sc);
-			Engine::ScriptEngine::OnStartEntity(entity, sc);
+			return nullptr;
 		}
 
-		return entity.GetUUID();
+		auto prefab = Engine::AssetManager::GetAsset<Engine::Prefab>(prefabID);
+		if (!prefab->Handle.IsValid())
+		{
+			return nullptr;
+		}
+
+		uint32_t count = (uint32_t)mono_array_length(positions);
+		if (count == 0)
+			return nullptr;
+
+		std::vector<Engine::TransformComponent> rootTransforms(count, prefab->GetRootTransform());
+		for (uint32_t i = 0; i < count; i++)
+			rootTransforms[i].Position = mono_array_get(positions, glm::vec3, i);
+
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
+		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
+		std::vector<Engine::Entity> roots = scene->InstantiatePrefab(prefabID, count, rootTransforms.data());
+
+		std::vector<Engine::UUID> rootIDs(roots.size());
+		for (size_t i = 0; i < roots.size(); i++)
+			rootIDs[i] = roots[i].GetUUID();
+
+		return Engine::ScriptEngine::ArrayToMonoArray(rootIDs.data(), Engine::ScriptFieldType::ULong, rootIDs.size());
 	}
 
 	MonoObject* ScriptGlue::Entity_GetScriptInstance(Engine::UUID entityID)
@@ -556,11 +640,29 @@ namespace InternalCalls
 
 	void ScriptGlue::Entity_DestroyEntity(Engine::UUID entityID)
 	{
-		Engine::Scene* scene = Engine::SceneManager::GetActiveScene().get();
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
 		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
 		Engine::Entity entity = scene->GetEntityWithUUID(entityID);
 		ENGINE_CORE_ASSERT(entity, "Entity with UUID: " + std::to_string(entityID) + " was not found in Scene!");
-		scene->DestroyEntity(entity);
+
+		// Scripts can run inside view iteration or a physics callback, destroy at the next sync point
+		if (scene->IsRunning())
+			scene->GetCommandBuffer().DestroyEntity(entityID);
+		else
+			scene->DestroyEntity(entity);
+	}
+
+	void ScriptGlue::Entity_Despawn(Engine::UUID entityID)
+	{
+		Engine::Scene* scene = Engine::ScriptEngine::GetSceneContext();
+		ENGINE_CORE_ASSERT(scene, "Active Scene Context was not set in Script Engine!");
+		Engine::Entity entity = scene->GetEntityWithUUID(entityID);
+		ENGINE_CORE_ASSERT(entity, "Entity with UUID: " + std::to_string(entityID) + " was not found in Scene!");
+
+		if (scene->IsRunning())
+			scene->GetCommandBuffer().Modify(entityID, [scene](Engine::Entity instance) { scene->DespawnPrefabInstance(instance); });
+		else
+			scene->DespawnPrefabInstance(entity);
 	}
 
 	uint64_t ScriptGlue::Entity_GetParent(Engine::UUID entityID)
@@ -123,10 +123,17 @@ namespace InternalCalls
 		static void Entity_AddComponent(Engine::UUID entityID, MonoReflectionType* componentType);
 
 		static uint64_t Entity_FindEntityByName(MonoString* name);
+		static MonoArray* Entity_FindEntitiesByName(MonoString* name);
+		static MonoArray* Entity_FindEntitiesWithNamePrefix(MonoString* prefix);
+		static MonoArray* Entity_FindEntitiesInRegion(glm::vec2* min, glm::vec2* max);
+		static MonoArray* Entity_FindEntitiesAtPoint(glm::vec2* point);
+		static MonoArray* Entity_FindEntitiesInRadius(glm::vec2* center, float radius);
 		static uint64_t Entity_CreateEntity(MonoString* name);
 		static uint64_t Entity_InstantiatePrefab(Engine::AssetHandle prefabID);
+		static MonoArray* Entity_InstantiatePrefabs(Engine::AssetHandle prefabID, MonoArray* positions);
 		static MonoObject* Entity_GetScriptInstance(Engine::UUID entityID);
 		static void Entity_DestroyEntity(Engine::UUID entityID);
+		static void Entity_Despawn(Engine::UUID entityID);
 
 		static uint64_t Entity_GetParent(Engine::UUID entityID);
 		static void Entity_SetParent(Engine::UUID entityID, Engine::UUID parentID);
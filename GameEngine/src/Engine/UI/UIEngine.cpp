@@ -1,37 +1,23 @@
 #include "enginepch.h"
 #include "Engine/UI/UIEngine.h"
 #include "Engine/Scripting/ScriptEngine.h"
-#include "Engine/Scene/SceneManager.h"
 
 #include <cstring>
 
 namespace Engine
 {
-	struct UIEngineData
-	{
-		glm::vec2 ViewportMousePos{ 0.0f };
-	};
-
-	static UIEngineData* s_UIEngineData = nullptr;
-
-	void UIEngine::OnUIStart()
-	{
-		ENGINE_PROFILE_FUNCTION();
-
-		s_UIEngineData = new UIEngineData();
-	}
-
-	void UIEngine::OnUIUpdate(Timestep ts, float viewportWidth, float viewportHeight)
+	void UIEngine::OnUIUpdate(Scene* scene, Timestep ts, float viewportWidth, float viewportHeight)
 	{
 		ENGINE_PROFILE_FUNCTION();
 
-		auto view = SceneManager::GetActiveScene()->GetAllEntitiesWith<UILayoutComponent>();
+		auto view = scene->GetAllEntitiesWith<UILayoutComponent>();
+		ECSProfiler::ScopedView profileView(scene->GetECSProfiler(), "UI Update", view.size());
 		for (auto e : view)
 		{
-			if (!SceneManager::GetActiveScene()->IsEntityHandleValid(e))
+			if (!scene->IsEntityHandleValid(e))
 				continue;
 			
-			Entity entity = { e, SceneManager::GetActiveScene().get() };
+			Entity entity = { e, scene };
 			bool isOver = UIEngine::IsOverElement(entity, viewportWidth, viewportHeight);
 
 			if (entity.HasComponent<UIButtonComponent>())
@@ -40,28 +26,25 @@ namespace Engine
 				button.ButtonState.Hovered = isOver;
 
 				if (isOver && Input::IsMouseButtonPressed(Mouse::MouseCode::ButtonLeft))
-					button.OnPressed();
+					button.OnPressed(scene);
 				else if (!Input::IsMouseButtonPressed(Mouse::MouseCode::ButtonLeft))
-					button.OnReleased();
+					button.OnReleased(scene);
 			}
 		}
 	}
 
-	void UIEngine::OnUIStop()
+	void UIEngine::SetViewportMousePos(Scene* scene, int mouseX, int mouseY)
 	{
-		ENGINE_PROFILE_FUNCTION();
-
-		delete s_UIEngineData;
+		if (UIContext* context = scene->GetUIContext())
+			context->ViewportMousePos = { mouseX, mouseY };
 	}
 
-	void UIEngine::SetViewportMousePos(int mouseX, int mouseY)
+	const glm::vec2 UIEngine::GetViewportMousePos(Scene* scene)
 	{
-		s_UIEngineData->ViewportMousePos = { mouseX, mouseY };
-	}
+		if (UIContext* context = scene->GetUIContext())
+			return context->ViewportMousePos;
 
-	const glm::vec2 UIEngine::GetViewportMousePos()
-	{
-		return s_UIEngineData->ViewportMousePos;
+		return glm::vec2{ 0.0f };
 	}
 
 	bool UIEngine::IsOverElement(Entity entity, float viewportWidth, float viewportHeight)
@@ -69,33 +52,15 @@ namespace Engine
 		if (!entity.HasComponent<UILayoutComponent>())
 			return false;
 
-		auto& layout = entity.GetComponent<UILayoutComponent>();
-
-		glm::mat4 transform = entity.GetUISpaceTransform();
-		glm::vec3 uiPos = Math::PositionFromTransform(transform);
+		// Hit test in the element's own space, so rotation and scale match what is drawn
+		Affine2D transform = entity.GetUISpaceAffine2D();
+		if (transform.Determinant() == 0.0f)
+			return false;
 
 		glm::vec2 halfViewportSize{ viewportWidth / 2, viewportHeight / 2 };
+		glm::vec2 localMousePos = transform.Inverse().Apply(GetViewportMousePos(entity.GetScene()) - halfViewportSize);
 
-		float xHalfSize = layout.Size.x / 2;
-		float yHalfSize = layout.Size.y / 2;
-
-		glm::vec2 xRange{ uiPos.x - xHalfSize, uiPos.x + xHalfSize };
-		xRange += halfViewportSize.x;
-		glm::vec2 yRange{ uiPos.y - yHalfSize, uiPos.y + yHalfSize };
-		yRange += halfViewportSize.y;
-
-		glm::vec2 viewportMousePos = s_UIEngineData->ViewportMousePos;
-
-		bool isOver = false;
-		if (viewportMousePos.x >= xRange.x &&
-			viewportMousePos.x <= xRange.y &&
-			viewportMousePos.y >= yRange.x &&
-			viewportMousePos.y <= yRange.y)
-		{
-			isOver = true;
-		}
-
-		return isOver;
+		return glm::abs(localMousePos.x) <= 0.5f && glm::abs(localMousePos.y) <= 0.5f;
 	}
 
 	Interaction::Interaction()
@@ -138,12 +103,12 @@ namespace Engine
 		}
 	}
 
-	void Interaction::Interacted()
+	void Interaction::Interacted(Scene* scene)
 	{
 		if (!InteractedEntityID.IsValid())
 			return;
 
-		Entity interactedEntity = SceneManager::GetActiveScene()->GetEntityWithUUID(InteractedEntityID);
+		Entity interactedEntity = scene->GetEntityWithUUID(InteractedEntityID);
 		ScriptComponent sc = interactedEntity.GetComponent<ScriptComponent>();
 		auto scriptMethod = ScriptEngine::GetScriptMethodMap(sc.ClassName).at(InteractedFunction);
 
@@ -179,7 +144,10 @@ namespace Engine
 			paramType = Params[i]->Field.Type;
 		}
 
+		Scene* previousContext = ScriptEngine::GetSceneContext();
+		ScriptEngine::SetSceneContext(scene);
 		scriptClass->InvokeMethod(scriptInstance->GetMonoObject(), scriptMethod.ClassMethod, m_FunctionParams);
+		ScriptEngine::SetSceneContext(previousContext);
 	}
 
 }
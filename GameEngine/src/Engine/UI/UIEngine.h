@@ -21,7 +21,7 @@ namespace Engine
 		void ClearParams();
 		void SetupParams(ScriptMethod scriptMethod);
 
-		void Interacted();
+		void Interacted(Scene* scene);
 	private:
 		void* m_FunctionParams[8]{};
 	};
@@ -33,17 +33,21 @@ namespace Engine
 		bool Pressed = false;
 	};
 
+	// UI state owned by a running scene
+	struct UIContext
+	{
+		glm::vec2 ViewportMousePos{ 0.0f };
+	};
+
 	class UIEngine
 	{
 	public:
 		UIEngine() = delete;
 
-		static void OnUIStart();
-		static void OnUIUpdate(Timestep ts, float viewportWidth, float viewportHeight);
-		static void OnUIStop();
+		static void OnUIUpdate(Scene* scene, Timestep ts, float viewportWidth, float viewportHeight);
 
-		static void SetViewportMousePos(int mouseX, int mouseY);
-		static const glm::vec2 GetViewportMousePos();
+		static void SetViewportMousePos(Scene* scene, int mouseX, int mouseY);
+		static const glm::vec2 GetViewportMousePos(Scene* scene);
 
 		static bool IsOverElement(Entity entity, float viewportWidth, float viewportHeight);
 	};
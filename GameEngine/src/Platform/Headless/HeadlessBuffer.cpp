@@ -0,0 +1,66 @@
+#include "enginepch.h"
+#include "Platform/Headless/HeadlessBuffer.h"
+#include "Platform/Headless/HeadlessCommandLog.h"
+
+namespace Engine
+{
+	/////////////////////////////////////////////////////////////////////////////
+	// VertexBuffer /////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	HeadlessVertexBuffer::HeadlessVertexBuffer(uint32_t size)
+		: m_RendererID(HeadlessCommandLog::CreateResource())
+	{
+		m_Data.reserve(size);
+	}
+
+	HeadlessVertexBuffer::HeadlessVertexBuffer(float* vertices, uint32_t size)
+		: m_RendererID(HeadlessCommandLog::CreateResource())
+	{
+		SetData(vertices, size);
+	}
+
+	HeadlessVertexBuffer::~HeadlessVertexBuffer()
+	{
+		HeadlessCommandLog::DestroyResource(m_RendererID);
+	}
+
+	void HeadlessVertexBuffer::Bind() const
+	{
+	}
+
+	void HeadlessVertexBuffer::Unbind() const
+	{
+	}
+
+	void HeadlessVertexBuffer::SetData(const void* data, uint32_t size)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		m_Data.assign((const uint8_t*)data, (const uint8_t*)data + size);
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BufferData, m_RendererID, size);
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// IndexBuffer //////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	HeadlessIndexBuffer::HeadlessIndexBuffer(uint32_t* indices, uint32_t count)
+		: m_RendererID(HeadlessCommandLog::CreateResource()), m_Count(count), m_Indices(indices, indices + count)
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BufferData, m_RendererID, count * sizeof(uint32_t));
+	}
+
+	HeadlessIndexBuffer::~HeadlessIndexBuffer()
+	{
+		HeadlessCommandLog::DestroyResource(m_RendererID);
+	}
+
+	void HeadlessIndexBuffer::Bind() const
+	{
+	}
+
+	void HeadlessIndexBuffer::Unbind() const
+	{
+	}
+}
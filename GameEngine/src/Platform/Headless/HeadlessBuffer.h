@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Engine/Renderer/Buffer.h"
+
+namespace Engine
+{
+	class HeadlessVertexBuffer : public VertexBuffer
+	{
+	public:
+		HeadlessVertexBuffer(uint32_t size);
+		HeadlessVertexBuffer(float* vertices, uint32_t size);
+		virtual ~HeadlessVertexBuffer();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+		virtual void SetData(const void* data, uint32_t size) override;
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		uint32_t GetRendererID() const { return m_RendererID; }
+		// Bytes of the last upload
+		const std::vector<uint8_t>& GetData() const { return m_Data; }
+	private:
+		uint32_t m_RendererID;
+		BufferLayout m_Layout;
+		std::vector<uint8_t> m_Data;
+	};
+
+	class HeadlessIndexBuffer : public IndexBuffer
+	{
+	public:
+		HeadlessIndexBuffer(uint32_t* indices, uint32_t count);
+		virtual ~HeadlessIndexBuffer();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+		virtual uint32_t GetCount() const override { return m_Count; }
+
+		uint32_t GetRendererID() const { return m_RendererID; }
+		const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
+	private:
+		uint32_t m_RendererID;
+		uint32_t m_Count;
+		std::vector<uint32_t> m_Indices;
+	};
+}
@@ -0,0 +1,147 @@
+#include "enginepch.h"
+#include "Platform/Headless/HeadlessCommandLog.h"
+
+namespace Engine
+{
+	struct HeadlessCommandLogData
+	{
+		bool Recording = false;
+		uint32_t NextResourceID = 1;
+		std::vector<HeadlessCommand> Commands;
+		HeadlessCommandLog::Statistics Stats;
+
+		// resources are created on the main thread while a render thread may be submitting
+		std::mutex Mutex;
+	};
+
+	static HeadlessCommandLogData s_HeadlessCommandLogData;
+
+	static void RecordCommand(HeadlessCommand::Type type, uint32_t resourceID, uint32_t arg0 = 0, uint32_t arg1 = 0, uint32_t arg2 = 0, uint32_t arg3 = 0, float value = 0.0f)
+	{
+		auto& stats = s_HeadlessCommandLogData.Stats;
+		switch (type)
+		{
+			case HeadlessCommand::Type::DrawIndexed:		stats.DrawCalls++; stats.IndicesDrawn += arg0; break;
+			case HeadlessCommand::Type::DrawLines:			stats.DrawCalls++; stats.LineVerticesDrawn += arg0; break;
+			case HeadlessCommand::Type::BufferData:
+			case HeadlessCommand::Type::UniformData:
+			case HeadlessCommand::Type::TextureData:		stats.BytesUploaded += arg0; break;
+			case HeadlessCommand::Type::SetViewport:
+			case HeadlessCommand::Type::SetClearColor:
+			case HeadlessCommand::Type::SetLineWidth:
+			case HeadlessCommand::Type::BindVertexArray:
+			case HeadlessCommand::Type::BindShader:
+			case HeadlessCommand::Type::BindTexture:
+			case HeadlessCommand::Type::BindFramebuffer:
+			case HeadlessCommand::Type::SetUniform:			stats.StateChanges++; break;
+			default: break;
+		}
+
+		if (!s_HeadlessCommandLogData.Recording)
+			return;
+
+		HeadlessCommand& command = s_HeadlessCommandLogData.Commands.emplace_back();
+		command.CommandType = type;
+		command.ResourceID = resourceID;
+		command.Args[0] = arg0;
+		command.Args[1] = arg1;
+		command.Args[2] = arg2;
+		command.Args[3] = arg3;
+		command.Value = value;
+	}
+
+	void HeadlessCommandLog::Record(HeadlessCommand::Type type, uint32_t resourceID, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3, float value)
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+		RecordCommand(type, resourceID, arg0, arg1, arg2, arg3, value);
+	}
+
+	uint32_t HeadlessCommandLog::CreateResource()
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+
+		uint32_t resourceID = s_HeadlessCommandLogData.NextResourceID++;
+		s_HeadlessCommandLogData.Stats.ResourcesAlive++;
+		RecordCommand(HeadlessCommand::Type::CreateResource, resourceID);
+		return resourceID;
+	}
+
+	void HeadlessCommandLog::DestroyResource(uint32_t resourceID)
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+
+		s_HeadlessCommandLogData.Stats.ResourcesAlive--;
+		RecordCommand(HeadlessCommand::Type::DestroyResource, resourceID);
+	}
+
+	void HeadlessCommandLog::SetRecording(bool recording)
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+		s_HeadlessCommandLogData.Recording = recording;
+	}
+
+	bool HeadlessCommandLog::IsRecording()
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+		return s_HeadlessCommandLogData.Recording;
+	}
+
+	std::vector<HeadlessCommand> HeadlessCommandLog::GetCommands()
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+		return s_HeadlessCommandLogData.Commands;
+	}
+
+	uint32_t HeadlessCommandLog::CountCommands(HeadlessCommand::Type type)
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+		return (uint32_t)std::count_if(s_HeadlessCommandLogData.Commands.begin(), s_HeadlessCommandLogData.Commands.end(),
+			[type](const HeadlessCommand& command) { return command.CommandType == type; });
+	}
+
+	HeadlessCommandLog::Statistics HeadlessCommandLog::GetStats()
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+		return s_HeadlessCommandLogData.Stats;
+	}
+
+	void HeadlessCommandLog::Reset()
+	{
+		std::scoped_lock<std::mutex> lock(s_HeadlessCommandLogData.Mutex);
+
+		// resources outlive a reset, keep their count
+		uint32_t resourcesAlive = s_HeadlessCommandLogData.Stats.ResourcesAlive;
+
+		s_HeadlessCommandLogData.Commands.clear();
+		s_HeadlessCommandLogData.Stats = Statistics();
+		s_HeadlessCommandLogData.Stats.ResourcesAlive = resourcesAlive;
+	}
+
+	const char* HeadlessCommandLog::CommandTypeToString(HeadlessCommand::Type type)
+	{
+		switch (type)
+		{
+			case HeadlessCommand::Type::Init:				return "Init";
+			case HeadlessCommand::Type::SetViewport:		return "SetViewport";
+			case HeadlessCommand::Type::SetClearColor:		return "SetClearColor";
+			case HeadlessCommand::Type::Clear:				return "Clear";
+			case HeadlessCommand::Type::SetLineWidth:		return "SetLineWidth";
+			case HeadlessCommand::Type::DrawIndexed:		return "DrawIndexed";
+			case HeadlessCommand::Type::DrawLines:			return "DrawLines";
+			case HeadlessCommand::Type::CreateResource:		return "CreateResource";
+			case HeadlessCommand::Type::DestroyResource:	return "DestroyResource";
+			case HeadlessCommand::Type::BindVertexArray:	return "BindVertexArray";
+			case HeadlessCommand::Type::BindShader:			return "BindShader";
+			case HeadlessCommand::Type::BindTexture:		return "BindTexture";
+			case HeadlessCommand::Type::BindFramebuffer:	return "BindFramebuffer";
+			case HeadlessCommand::Type::BufferData:			return "BufferData";
+			case HeadlessCommand::Type::UniformData:		return "UniformData";
+			case HeadlessCommand::Type::TextureData:		return "TextureData";
+			case HeadlessCommand::Type::SetUniform:			return "SetUniform";
+			case HeadlessCommand::Type::ResizeFramebuffer:	return "ResizeFramebuffer";
+		}
+
+		ENGINE_CORE_ASSERT(false, "Unknown headless command type!");
+		return "Unknown";
+	}
+}
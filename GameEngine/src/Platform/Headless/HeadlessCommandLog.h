@@ -0,0 +1,54 @@
+#pragma once
+
+namespace Engine
+{
+	struct HeadlessCommand
+	{
+		enum class Type
+		{
+			Init = 0, SetViewport, SetClearColor, Clear, SetLineWidth,
+			DrawIndexed, DrawLines,
+			CreateResource, DestroyResource,
+			BindVertexArray, BindShader, BindTexture, BindFramebuffer,
+			BufferData, UniformData, TextureData, SetUniform, ResizeFramebuffer
+		};
+
+		Type CommandType = Type::Init;
+		uint32_t ResourceID = 0;
+		uint32_t Args[4] = {};
+		float Value = 0.0f;
+	};
+
+	// Captures everything the headless renderer backend is asked to do,
+	// so renderer throughput can be measured and inspected without a GPU
+	class HeadlessCommandLog
+	{
+	public:
+		struct Statistics
+		{
+			uint32_t DrawCalls = 0;
+			uint64_t IndicesDrawn = 0;
+			uint64_t LineVerticesDrawn = 0;
+			uint64_t BytesUploaded = 0;
+			uint32_t StateChanges = 0;
+			uint32_t ResourcesAlive = 0;
+		};
+
+		static void Record(HeadlessCommand::Type type, uint32_t resourceID = 0, uint32_t arg0 = 0, uint32_t arg1 = 0, uint32_t arg2 = 0, uint32_t arg3 = 0, float value = 0.0f);
+		static uint32_t CreateResource();
+		static void DestroyResource(uint32_t resourceID);
+
+		// Stats are always kept, the command list only while recording is enabled. Off by default,
+		// the list grows with every command until Reset
+		static void SetRecording(bool recording);
+		static bool IsRecording();
+
+		// A copy, the render thread may be recording
+		static std::vector<HeadlessCommand> GetCommands();
+		static uint32_t CountCommands(HeadlessCommand::Type type);
+		static Statistics GetStats();
+		static void Reset();
+
+		static const char* CommandTypeToString(HeadlessCommand::Type type);
+	};
+}
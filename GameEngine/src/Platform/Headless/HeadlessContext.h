@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Engine/Renderer/GraphicsContext.h"
+
+namespace Engine
+{
+	class HeadlessContext : public GraphicsContext
+	{
+	public:
+		virtual void Init() override {}
+		virtual void SwapBuffers() override {}
+	};
+}
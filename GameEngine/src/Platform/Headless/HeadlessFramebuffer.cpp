@@ -0,0 +1,66 @@
+#include "enginepch.h"
+#include "Platform/Headless/HeadlessFramebuffer.h"
+#include "Platform/Headless/HeadlessCommandLog.h"
+
+namespace Engine
+{
+	static const uint32_t s_MaxHeadlessFrameBufferSize = 8192;
+
+	HeadlessFramebuffer::HeadlessFramebuffer(const FramebufferSpecification& spec)
+		: m_RendererID(HeadlessCommandLog::CreateResource()), m_Specification(spec)
+	{
+		for (auto attachment : m_Specification.Attachments.Attachments)
+		{
+			if (attachment.TextureFormat == FramebufferTextureFormat::DEPTH24STENCIL8)
+				continue;
+
+			m_ColorAttachments.emplace_back(HeadlessCommandLog::CreateResource());
+			m_ClearValues.emplace_back(-1);
+		}
+	}
+
+	HeadlessFramebuffer::~HeadlessFramebuffer()
+	{
+		for (uint32_t attachment : m_ColorAttachments)
+			HeadlessCommandLog::DestroyResource(attachment);
+		HeadlessCommandLog::DestroyResource(m_RendererID);
+	}
+
+	void HeadlessFramebuffer::Bind()
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BindFramebuffer, m_RendererID);
+		HeadlessCommandLog::Record(HeadlessCommand::Type::SetViewport, 0, 0, 0, m_Specification.Width, m_Specification.Height);
+	}
+
+	void HeadlessFramebuffer::Unbind()
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BindFramebuffer, 0);
+	}
+
+	void HeadlessFramebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0 || width > s_MaxHeadlessFrameBufferSize || height > s_MaxHeadlessFrameBufferSize)
+		{
+			ENGINE_CORE_WARN("Attempting to resize framebuffer to {0}, {1}", width, height);
+			return;
+		}
+
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+
+		HeadlessCommandLog::Record(HeadlessCommand::Type::ResizeFramebuffer, m_RendererID, width, height);
+	}
+
+	int HeadlessFramebuffer::ReadPixel(uint32_t attachmentIndex, int x, int y)
+	{
+		ENGINE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "attachmentIndex out of bounds");
+		return m_ClearValues[attachmentIndex];
+	}
+
+	void HeadlessFramebuffer::ClearAttachment(uint32_t attachmentIndex, int value)
+	{
+		ENGINE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "attachmentIndex out of bounds");
+		m_ClearValues[attachmentIndex] = value;
+		HeadlessCommandLog::Record(HeadlessCommand::Type::Clear, m_ColorAttachments[attachmentIndex], (uint32_t)value);
+	}
+}
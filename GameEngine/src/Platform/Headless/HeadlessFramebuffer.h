@@ -0,0 +1,31 @@
+#pragma once
+#include "Engine/Renderer/Framebuffer.h"
+
+namespace Engine
+{
+	class HeadlessFramebuffer : public Framebuffer
+	{
+	public:
+		HeadlessFramebuffer(const FramebufferSpecification& spec);
+		virtual ~HeadlessFramebuffer();
+
+		virtual void Bind() override;
+		virtual void Unbind() override;
+
+		virtual void Resize(uint32_t width, uint32_t height) override;
+		// No pixels are rasterized, returns the last value the attachment was cleared to
+		int ReadPixel(uint32_t attachmentIndex, int x, int y) override;
+
+		void ClearAttachment(uint32_t attachmentIndex, int value) override;
+
+		virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const override { ENGINE_CORE_ASSERT(index < m_ColorAttachments.size(), "Index out of bounds."); return m_ColorAttachments[index]; }
+
+		virtual const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+	private:
+		uint32_t m_RendererID;
+		FramebufferSpecification m_Specification;
+
+		std::vector<uint32_t> m_ColorAttachments;
+		std::vector<int> m_ClearValues;
+	};
+}
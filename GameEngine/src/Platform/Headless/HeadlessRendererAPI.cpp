@@ -0,0 +1,48 @@
+#include "enginepch.h"
+#include "Platform/Headless/HeadlessRendererAPI.h"
+#include "Platform/Headless/HeadlessCommandLog.h"
+#include "Platform/Headless/HeadlessVertexArray.h"
+
+namespace Engine
+{
+	void HeadlessRendererAPI::Init()
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		HeadlessCommandLog::Record(HeadlessCommand::Type::Init);
+	}
+
+	void HeadlessRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::SetViewport, 0, x, y, width, height);
+	}
+
+	void HeadlessRendererAPI::SetClearColor(const glm::vec4& color)
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::SetClearColor, 0,
+			(uint32_t)(color.r * 255.0f), (uint32_t)(color.g * 255.0f), (uint32_t)(color.b * 255.0f), (uint32_t)(color.a * 255.0f));
+	}
+
+	void HeadlessRendererAPI::Clear()
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::Clear);
+	}
+
+	void HeadlessRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+	{
+		vertexArray->Bind();
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		HeadlessCommandLog::Record(HeadlessCommand::Type::DrawIndexed, std::static_pointer_cast<HeadlessVertexArray>(vertexArray)->GetRendererID(), count);
+	}
+
+	void HeadlessRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount)
+	{
+		vertexArray->Bind();
+		HeadlessCommandLog::Record(HeadlessCommand::Type::DrawLines, std::static_pointer_cast<HeadlessVertexArray>(vertexArray)->GetRendererID(), vertexCount);
+	}
+
+	void HeadlessRendererAPI::SetLineWidth(float width)
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::SetLineWidth, 0, 0, 0, 0, 0, width);
+	}
+}
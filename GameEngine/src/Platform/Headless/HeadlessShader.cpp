@@ -0,0 +1,72 @@
+#include "enginepch.h"
+#include "Platform/Headless/HeadlessShader.h"
+#include "Platform/Headless/HeadlessCommandLog.h"
+
+namespace Engine
+{
+	HeadlessShader::HeadlessShader(const std::string& filepath)
+		: m_RendererID(HeadlessCommandLog::CreateResource())
+	{
+		// Extract name from filepath
+		auto lastSlash = filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = filepath.rfind('.');
+		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+		m_Name = filepath.substr(lastSlash, count);
+	}
+
+	HeadlessShader::HeadlessShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
+		: m_RendererID(HeadlessCommandLog::CreateResource()), m_Name(name)
+	{
+	}
+
+	HeadlessShader::~HeadlessShader()
+	{
+		HeadlessCommandLog::DestroyResource(m_RendererID);
+	}
+
+	void HeadlessShader::Bind() const
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BindShader, m_RendererID);
+	}
+
+	void HeadlessShader::Unbind() const
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BindShader, 0);
+	}
+
+	void HeadlessShader::SetInt(const std::string& name, int value)
+	{
+		RecordUniform(sizeof(int));
+	}
+
+	void HeadlessShader::SetIntArray(const std::string& name, int* values, uint32_t count)
+	{
+		RecordUniform(sizeof(int) * count);
+	}
+
+	void HeadlessShader::SetFloat(const std::string& name, const float value)
+	{
+		RecordUniform(sizeof(float));
+	}
+
+	void HeadlessShader::SetFloat3(const std::string& name, const glm::vec3& value)
+	{
+		RecordUniform(sizeof(glm::vec3));
+	}
+
+	void HeadlessShader::SetFloat4(const std::string& name, const glm::vec4& value)
+	{
+		RecordUniform(sizeof(glm::vec4));
+	}
+
+	void HeadlessShader::SetMat4(const std::string& name, const glm::mat4& value)
+	{
+		RecordUniform(sizeof(glm::mat4));
+	}
+
+	void HeadlessShader::RecordUniform(uint32_t size) const
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::SetUniform, m_RendererID, size);
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Engine/Renderer/Shader.h"
+
+namespace Engine
+{
+	// Skips compilation entirely, only records binds and uniform uploads
+	class HeadlessShader : public Shader
+	{
+	public:
+		HeadlessShader(const std::string& filepath);
+		HeadlessShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+		virtual ~HeadlessShader();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void SetInt(const std::string& name, int value) override;
+		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override;
+
+		virtual void SetFloat(const std::string& name, const float value) override;
+		virtual void SetFloat3(const std::string& name, const glm::vec3& value) override;
+		virtual void SetFloat4(const std::string& name, const glm::vec4& value) override;
+
+		virtual void SetMat4(const std::string& name, const glm::mat4& value) override;
+
+		virtual const std::string& GetName() const override { return m_Name; }
+	private:
+		void RecordUniform(uint32_t size) const;
+	private:
+		uint32_t m_RendererID;
+		std::string m_Name;
+	};
+}
@@ -0,0 +1,62 @@
+#include "enginepch.h"
+#include "Platform/Headless/HeadlessTexture.h"
+#include "Platform/Headless/HeadlessCommandLog.h"
+
+namespace Engine
+{
+	namespace Utils
+	{
+		static uint32_t HeadlessBytesPerPixel(ImageFormat format)
+		{
+			switch (format)
+			{
+				case ImageFormat::R8:		return 1;
+				case ImageFormat::RGB8:		return 3;
+				case ImageFormat::RGBA8:	return 4;
+				case ImageFormat::RGBA32F:	return 16;
+				default: break;
+			}
+
+			ENGINE_CORE_ASSERT(false, "Unknown image format!");
+			return 0;
+		}
+	}
+
+	HeadlessTexture2D::HeadlessTexture2D(const TextureSpecification& specification, Buffer data)
+		: m_Width(specification.Width), m_Height(specification.Height), m_RendererID(HeadlessCommandLog::CreateResource()), m_Format(specification.Format)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		if (data)
+			SetData(data);
+	}
+
+	HeadlessTexture2D::~HeadlessTexture2D()
+	{
+		HeadlessCommandLog::DestroyResource(m_RendererID);
+	}
+
+	void HeadlessTexture2D::ChangeSize(uint32_t newWidth, uint32_t newHeight)
+	{
+		m_Width = newWidth;
+		m_Height = newHeight;
+		m_Data.clear();
+	}
+
+	void HeadlessTexture2D::SetData(Buffer data)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		uint32_t size = m_Width * m_Height * Utils::HeadlessBytesPerPixel(m_Format);
+		ENGINE_CORE_ASSERT(data.Size == size, "Data must be entire texture!");
+
+		m_Data.assign(data.Data, data.Data + data.Size);
+		m_HasAlpha = DataHasAlpha(m_Format, data);
+		HeadlessCommandLog::Record(HeadlessCommand::Type::TextureData, m_RendererID, (uint32_t)data.Size, m_Width, m_Height);
+	}
+
+	void HeadlessTexture2D::Bind(uint32_t slot) const
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BindTexture, m_RendererID, slot);
+	}
+}
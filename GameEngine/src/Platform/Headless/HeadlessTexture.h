@@ -0,0 +1,37 @@
+#pragma once
+#include "Engine/Renderer/Texture.h"
+
+namespace Engine
+{
+	class HeadlessTexture2D : public Texture2D
+	{
+	public:
+		HeadlessTexture2D(const TextureSpecification& specification, Buffer data = Buffer());
+		virtual ~HeadlessTexture2D();
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+		void ChangeSize(uint32_t newWidth, uint32_t newHeight) override;
+
+		virtual void SetData(Buffer data) override;
+		virtual bool HasAlpha() const override { return m_HasAlpha; }
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual bool operator==(const Texture& other) const override
+		{
+			return m_RendererID == other.GetRendererID();
+		}
+
+		const std::vector<uint8_t>& GetData() const { return m_Data; }
+	private:
+		uint32_t m_Width;
+		uint32_t m_Height;
+		uint32_t m_RendererID;
+		ImageFormat m_Format;
+		std::vector<uint8_t> m_Data;
+		bool m_HasAlpha = false;
+	};
+}
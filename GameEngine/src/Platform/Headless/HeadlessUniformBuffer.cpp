@@ -0,0 +1,25 @@
+#include "enginepch.h"
+#include "Platform/Headless/HeadlessUniformBuffer.h"
+#include "Platform/Headless/HeadlessCommandLog.h"
+
+namespace Engine
+{
+	HeadlessUniformBuffer::HeadlessUniformBuffer(uint32_t size, uint32_t binding)
+		: m_RendererID(HeadlessCommandLog::CreateResource()), m_Binding(binding), m_Data(size)
+	{
+	}
+
+	HeadlessUniformBuffer::~HeadlessUniformBuffer()
+	{
+		HeadlessCommandLog::DestroyResource(m_RendererID);
+	}
+
+	void HeadlessUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		ENGINE_PROFILE_FUNCTION();
+
+		ENGINE_CORE_ASSERT(offset + size <= m_Data.size(), "Uniform buffer write out of bounds!");
+		memcpy(m_Data.data() + offset, data, size);
+		HeadlessCommandLog::Record(HeadlessCommand::Type::UniformData, m_RendererID, size, offset, m_Binding);
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Engine/Renderer/UniformBuffer.h"
+
+namespace Engine
+{
+	class HeadlessUniformBuffer : public UniformBuffer
+	{
+	public:
+		HeadlessUniformBuffer(uint32_t size, uint32_t binding);
+		virtual ~HeadlessUniformBuffer();
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset) override;
+
+		uint32_t GetBinding() const { return m_Binding; }
+		const std::vector<uint8_t>& GetData() const { return m_Data; }
+	private:
+		uint32_t m_RendererID;
+		uint32_t m_Binding;
+		std::vector<uint8_t> m_Data;
+	};
+}
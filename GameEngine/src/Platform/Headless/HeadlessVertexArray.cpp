@@ -0,0 +1,38 @@
+#include "enginepch.h"
+#include "Platform/Headless/HeadlessVertexArray.h"
+#include "Platform/Headless/HeadlessCommandLog.h"
+
+namespace Engine
+{
+	HeadlessVertexArray::HeadlessVertexArray()
+		: m_RendererID(HeadlessCommandLog::CreateResource())
+	{
+	}
+
+	HeadlessVertexArray::~HeadlessVertexArray()
+	{
+		HeadlessCommandLog::DestroyResource(m_RendererID);
+	}
+
+	void HeadlessVertexArray::Bind() const
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BindVertexArray, m_RendererID);
+	}
+
+	void HeadlessVertexArray::Unbind() const
+	{
+		HeadlessCommandLog::Record(HeadlessCommand::Type::BindVertexArray, 0);
+	}
+
+	void HeadlessVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	{
+		ENGINE_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+
+	void HeadlessVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+	{
+		m_IndexBuffer = indexBuffer;
+	}
+}
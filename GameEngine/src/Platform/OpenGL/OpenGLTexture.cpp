@@ -153,6 +153,7 @@ namespace Engine
 		uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
 		ENGINE_CORE_ASSERT(data.Size == m_Width * m_Height * bpp, "Data must be entire texture!");
 		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data.Data);
+		m_HasAlpha = DataHasAlpha(Utils::GLInternalFormatToEngineImageFormat(m_InternalFormat), data);
 	}
 
 	void OpenGLTexture2D::Bind(uint32_t slot) const
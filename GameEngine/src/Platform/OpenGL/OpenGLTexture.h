@@ -19,6 +19,7 @@ namespace Engine
 		void ChangeSize(uint32_t newWidth, uint32_t newHeight) override;
 
 		virtual void SetData(Buffer data) override;
+		virtual bool HasAlpha() const override { return m_HasAlpha; }
 		
 		virtual void Bind(uint32_t slot = 0) const override;
 		
@@ -32,5 +33,6 @@ namespace Engine
 		uint32_t m_Height;
 		uint32_t m_RendererID{};
 		GLenum m_InternalFormat, m_DataFormat;
+		bool m_HasAlpha = false;
 	};
 }
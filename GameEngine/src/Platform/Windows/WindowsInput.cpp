@@ -9,6 +9,9 @@ namespace Engine
 {
 	bool Input::IsKeyPressed(const KeyCode key)
 	{
+		if (Application::Get().GetSpecification().Headless)
+			return false;
+
 		auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
 		auto state = glfwGetKey(window, static_cast<int32_t>(key));
 		return state == GLFW_PRESS;
@@ -16,6 +19,9 @@ namespace Engine
 
 	bool Input::IsMouseButtonPressed(const MouseCode button)
 	{
+		if (Application::Get().GetSpecification().Headless)
+			return false;
+
 		auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
 		auto state = glfwGetMouseButton(window, static_cast<int32_t>(button));
 		return state == GLFW_PRESS;
@@ -23,6 +29,9 @@ namespace Engine
 
 	glm::vec2 Input::GetMousePosition()
 	{
+		if (Application::Get().GetSpecification().Headless)
+			return { 0.0f, 0.0f };
+
 		if (!Application::Get().GetSpecification().Runtime)
 		{
 			auto [mx, my] = ImGui::GetMousePos();
@@ -49,13 +49,18 @@ void Standalone::OnUpdate(Engine::Timestep ts)
 	Engine::RenderCommand::SetClearColor({0.0f, 0.0f, 0.0f, 1.0f});
 	Engine::RenderCommand::Clear();
 
+	// Async loads swap or merge scenes here, between updates
+	Engine::SceneManager::UpdateSceneLoading();
+
 	auto& window = Engine::Application::Get().GetWindow();
 	Engine::SceneManager::GetActiveScene()->OnViewportResize(window.GetWidth(), window.GetHeight());
 
 	Engine::SceneManager::GetActiveScene()->OnUpdateRuntime(ts);
 
+	// Scripts may have loaded another scene during the update
+	Engine::Ref<Engine::Scene> scene = Engine::SceneManager::GetActiveScene();
 	glm::vec2 mousePos = Engine::Input::GetMousePosition();
-	Engine::UIEngine::SetViewportMousePos(mousePos.x, window.GetHeight() - mousePos.y); // y is inverted
+	Engine::UIEngine::SetViewportMousePos(scene.get(), mousePos.x, window.GetHeight() - mousePos.y); // y is inverted
 }
 
 void Standalone::OnImGuiRender()
@@ -41,6 +41,8 @@ group ""
 
 group "Tools"
 	include "Engine-Editor"
+	include "Engine-Headless"
+	include "Engine-Bench"
 group ""
 
 group "Misc"